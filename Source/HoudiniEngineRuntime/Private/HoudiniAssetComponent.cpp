@@ -25,6 +25,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineAttributeDirectory.h"
 #include "HoudiniEngineBakeUtils.h"
 #include "HoudiniEngineMaterialUtils.h"
 #include "HoudiniEngine.h"
@@ -58,6 +59,7 @@
 #include "HoudiniInstancedActorComponent.h"
 #include "HoudiniParamUtils.h"
 #include "HoudiniLandscapeUtils.h"
+#include "HoudiniEngineApiProfiler.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Runtime/Engine/Classes/Landscape/Landscape.h"
 #include "MessageLog.h"
@@ -311,12 +313,14 @@ UHoudiniAssetComponent::UHoudiniAssetComponent( const class FPostConstructInitia
     HoudiniAssetComponentMaterials = nullptr;
 #if WITH_EDITOR
     CopiedHoudiniComponent = nullptr;
+    DeferredStaticMeshBuildCount = 0;
 #endif
     AssetId = -1;
     GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
     TransformScaleFactor = HAPI_UNREAL_SCALE_FACTOR_TRANSLATION;
     ImportAxis = HRSAI_Unreal;
     HapiNotificationStarted = 0.0;
+    LastParameterChangeTime = 0.0;
     AssetCookCount = 0;
     HoudiniAssetComponentTransientFlagsPacked = 0u;
 
@@ -610,7 +614,8 @@ UHoudiniAssetComponent::SetHoudiniAsset( UHoudiniAsset * InHoudiniAsset )
 
     if ( !bIsPreviewComponent )
     {
-        if ( HoudiniEngine.IsInitialized() )
+        // Instantiation tasks issued while the session is starting are queued until it is ready.
+        if ( HoudiniEngine.IsInitialized() || HoudiniEngine.IsSessionStarting() )
         {
             if ( !bLoadedComponent )
             {
@@ -1318,6 +1323,8 @@ UHoudiniAssetComponent::PostCook( bool bCookError )
     // Show busy cursor.
     FScopedBusyCursor ScopedBusyCursor;
 
+    FHoudiniEngineApiProfilerScope ProfilerScope( GetOwner()->GetName(), TEXT( "Translate" ) );
+
     // Create parameters and inputs.
     CreateParameters();
     CreateInputs();
@@ -1330,6 +1337,9 @@ UHoudiniAssetComponent::PostCook( bool bCookError )
         return;
     }
 
+    // Strings resolved while translating the cook results are cached until we are done.
+    FHoudiniEngineStringCacheScope StringCacheScope;
+
     FTransform ComponentTransform;
     TMap< FHoudiniGeoPartObject, UStaticMesh * > NewStaticMeshes;
     
@@ -1338,6 +1348,13 @@ UHoudiniAssetComponent::PostCook( bool bCookError )
     HoudiniCookParams.MaterialAndTextureBakeMode = FHoudiniCookParams::GetDefaultMaterialAndTextureCookMode();
 	HoudiniCookParams.NumLODsToGenerate = this->NumLODsToGenerate;
 
+    // Static meshes can be built over the next ticks instead of blocking the editor now.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings && HoudiniRuntimeSettings->bDeferStaticMeshBuild )
+        HoudiniCookParams.DeferredStaticMeshBuilds = &DeferredStaticMeshBuilds;
+
+    const int32 DeferredStaticMeshBuildsBeforeCook = DeferredStaticMeshBuilds.Num();
+
     if ( FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
         GetAssetId(),
         HoudiniCookParams,
@@ -1375,6 +1392,29 @@ UHoudiniAssetComponent::PostCook( bool bCookError )
         // Update the bake folder as it might have been updated by an override
         BakeFolder = HoudiniCookParams.BakeFolder;
 
+        // Instancers are created from the render data of the meshes they instance, so if this cook has any,
+        // the queued meshes are built now. Otherwise they are built over the next ticks.
+        bool bHasInstancers = false;
+        for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( NewStaticMeshes ); Iter; ++Iter )
+        {
+            if ( Iter.Key().IsInstancer() || Iter.Key().IsPackedPrimitiveInstancer() )
+            {
+                bHasInstancers = true;
+                break;
+            }
+        }
+
+        if ( bHasInstancers && DeferredStaticMeshBuilds.Num() > 0 )
+        {
+            BuildDeferredStaticMeshes( -1.0 );
+        }
+        else
+        {
+            DeferredStaticMeshBuildCount += DeferredStaticMeshBuilds.Num() - DeferredStaticMeshBuildsBeforeCook;
+            if ( DeferredStaticMeshBuilds.Num() > 0 )
+                StartHoudiniTicking();
+        }
+
         // Set meshes and create new components for those meshes that do not have them.
         if ( NewStaticMeshes.Num() > 0 )
             CreateObjectGeoPartResources( NewStaticMeshes );
@@ -1768,6 +1808,11 @@ UHoudiniAssetComponent::TickHoudiniComponent()
 				// Create asset cooking task object and submit it for processing.
 				StartTaskAssetCooking();
 			}
+			else if (bParametersChanged && !bManualRecookRequested && IsParameterUploadDelayed())
+			{
+				// Parameters are still being edited, wait for the edits to settle so only
+				// their latest values are uploaded before the next cook.
+			}
 			else
 			{
 				if ( IsCookingEnabled() || bManualRecookRequested )
@@ -1819,6 +1864,14 @@ UHoudiniAssetComponent::TickHoudiniComponent()
 		bNeedToUpdateNavigationSystem = false;
 	}
 
+	// Build the meshes queued by the last cooks, a few at a time so the editor stays responsive.
+	if ( DeferredStaticMeshBuilds.Num() > 0 )
+	{
+		const double TimeBudget = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->DeferredStaticMeshBuildTimeBudget / 1000.0 : 0.05;
+		if ( !BuildDeferredStaticMeshes( TimeBudget ) )
+			bStopTicking = false;
+	}
+
 	if ( bStopTicking )
 		StopHoudiniTicking();
 
@@ -1827,6 +1880,111 @@ UHoudiniAssetComponent::TickHoudiniComponent()
 
 #if WITH_EDITOR
 
+bool
+UHoudiniAssetComponent::BuildDeferredStaticMeshes( double TimeBudget )
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Get settings.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    bool bDisplaySlateCookingNotifications = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bDisplaySlateCookingNotifications;
+
+    // Build in queue order, at least one mesh per call so we always make progress.
+    int32 BuiltCount = 0;
+    while ( DeferredStaticMeshBuilds.Num() > BuiltCount )
+    {
+        if ( BuiltCount > 0 && TimeBudget >= 0.0 && ( FPlatformTime::Seconds() - StartTime ) >= TimeBudget )
+            break;
+
+        UStaticMesh * StaticMesh = DeferredStaticMeshBuilds[ BuiltCount++ ].Get();
+        if ( !StaticMesh || StaticMesh->IsPendingKill() )
+            continue;
+
+        FHoudiniScopedGlobalSilence ScopedGlobalSilence;
+        StaticMesh->Build( false );
+    }
+
+    DeferredStaticMeshBuilds.RemoveAt( 0, BuiltCount );
+
+    if ( DeferredStaticMeshBuilds.Num() > 0 )
+    {
+        // Report progress.
+        FHoudiniEngineTaskInfo TaskInfo(
+            HAPI_RESULT_SUCCESS, AssetId, EHoudiniEngineTaskType::AssetCooking, EHoudiniEngineTaskState::Processing );
+
+        const int32 TotalCount = FMath::Max( DeferredStaticMeshBuildCount, DeferredStaticMeshBuilds.Num() );
+        TaskInfo.StatusText = FText::Format(
+            LOCTEXT( "BuildingStaticMeshes", "Building static meshes ({0} / {1})" ),
+            FText::AsNumber( TotalCount - DeferredStaticMeshBuilds.Num() ), FText::AsNumber( TotalCount ) );
+
+        if ( !DeferredStaticMeshBuildGUID.IsValid() )
+            DeferredStaticMeshBuildGUID = FGuid::NewGuid();
+
+        FHoudiniEngine::Get().AddTaskInfo( DeferredStaticMeshBuildGUID, TaskInfo );
+
+        if ( bDisplaySlateCookingNotifications && !IsPIEActive() )
+        {
+            TSharedPtr< SNotificationItem > NotificationItem = NotificationPtr.Pin();
+            if ( NotificationItem.IsValid() )
+            {
+                NotificationItem->SetText( TaskInfo.StatusText );
+            }
+            else
+            {
+                FNotificationInfo Info( TaskInfo.StatusText );
+                Info.bFireAndForget = false;
+
+                TSharedPtr< FSlateDynamicImageBrush > HoudiniBrush = FHoudiniEngine::Get().GetHoudiniLogoBrush();
+                if ( HoudiniBrush.IsValid() )
+                    Info.Image = HoudiniBrush.Get();
+
+                NotificationPtr = FSlateNotificationManager::Get().AddNotification( Info );
+            }
+        }
+
+        return false;
+    }
+
+    // All meshes are built, components using them need their bounds and physics updated.
+    if ( BuiltCount > 0 )
+    {
+        UpdateRenderingInformation();
+
+        if ( GEditor )
+            GEditor->RedrawAllViewports();
+    }
+
+    if ( DeferredStaticMeshBuildGUID.IsValid() )
+    {
+        FHoudiniEngine::Get().RemoveTaskInfo( DeferredStaticMeshBuildGUID );
+        DeferredStaticMeshBuildGUID.Invalidate();
+
+        // Only close the notification if nothing else is reporting through it.
+        TSharedPtr< SNotificationItem > NotificationItem = NotificationPtr.Pin();
+        if ( NotificationItem.IsValid() && !HapiGUID.IsValid() )
+        {
+            NotificationItem->SetText( LOCTEXT( "FinishedBuildingStaticMeshes", "Finished building static meshes" ) );
+            NotificationItem->ExpireAndFadeout();
+            NotificationPtr.Reset();
+        }
+    }
+
+    DeferredStaticMeshBuildCount = 0;
+    return true;
+}
+
+bool
+UHoudiniAssetComponent::BuildDeferredStaticMesh( UStaticMesh * StaticMesh )
+{
+    if ( !StaticMesh || DeferredStaticMeshBuilds.Remove( StaticMesh ) == 0 )
+        return false;
+
+    FHoudiniScopedGlobalSilence ScopedGlobalSilence;
+    StaticMesh->Build( false );
+
+    return true;
+}
+
 void
 UHoudiniAssetComponent::UpdateEditorProperties( bool bConditionalUpdate )
 {
@@ -2982,6 +3140,14 @@ UHoudiniAssetComponent::OnComponentCreated()
 void
 UHoudiniAssetComponent::OnComponentDestroyed()
 {
+    // Meshes still waiting to be built are about to be released.
+    DeferredStaticMeshBuilds.Empty();
+    if ( DeferredStaticMeshBuildGUID.IsValid() )
+    {
+        FHoudiniEngine::Get().RemoveTaskInfo( DeferredStaticMeshBuildGUID );
+        DeferredStaticMeshBuildGUID.Invalidate();
+    }
+
     // Release static mesh related resources.
     ReleaseObjectGeoPartResources( StaticMeshes );
     StaticMeshes.Empty();
@@ -3643,6 +3809,17 @@ UHoudiniAssetComponent::IsCookingEnabled() const
     return FHoudiniEngine::Get().GetEnableCookingGlobal() && bEnableCooking;
 }
 
+bool
+UHoudiniAssetComponent::IsParameterUploadDelayed() const
+{
+    float ParameterUploadDelay = 0.0f;
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+        ParameterUploadDelay = HoudiniRuntimeSettings->ParameterUploadDelay;
+
+    return ( FPlatformTime::Seconds() - LastParameterChangeTime ) < ParameterUploadDelay;
+}
+
 void
 UHoudiniAssetComponent::PostEditUndo()
 {
@@ -3929,6 +4106,8 @@ UHoudiniAssetComponent::CreateCurves( const TArray< FHoudiniGeoPartObject > & Fo
 
         // We need to cook the spline node.
         FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), NodeId, nullptr);
+        FHoudiniEngineStringCache::Reset();
+        FHoudiniEngineAttributeDirectory::Reset();
 
         FString CurvePointsString;
         EHoudiniSplineComponentType::Enum CurveTypeValue = EHoudiniSplineComponentType::Bezier;
@@ -4075,6 +4254,7 @@ UHoudiniAssetComponent::NotifyParameterChanged( UHoudiniAssetParameter * Houdini
             bEditorPropertiesNeedFullUpdate = false;
     }
 
+    LastParameterChangeTime = FPlatformTime::Seconds();
     bParametersChanged = true;
     StartHoudiniTicking();
 }
@@ -4110,6 +4290,8 @@ UHoudiniAssetComponent::UploadChangedParameters()
 {
     bool Success = true;
 
+    FHoudiniEngineApiProfilerScope ProfilerScope( GetOwner()->GetName(), TEXT( "Upload" ) );
+
     if ( bParametersChanged )
     {
         // Upload inputs.
@@ -4124,17 +4306,18 @@ UHoudiniAssetComponent::UploadChangedParameters()
             }
         }
 
-        // Upload parameters.
+        // Upload parameters, adjacent int and float values are merged into a single call.
+        TArray< UHoudiniAssetParameter * > ChangedParameters;
         for ( TMap< HAPI_ParmId, UHoudiniAssetParameter * >::TIterator IterParams( Parameters ); IterParams; ++IterParams )
         {
             UHoudiniAssetParameter * HoudiniAssetParameter = IterParams.Value();
 
             // If parameter has changed, upload it to HAPI.
             if ( HoudiniAssetParameter->HasChanged() )
-            {
-                Success &= HoudiniAssetParameter->UploadParameterValue();
-            }
+                ChangedParameters.Add( HoudiniAssetParameter );
         }
+
+        Success &= FHoudiniParamUtils::UploadParameterValues( ChangedParameters );
     }
 
     if( !Success )
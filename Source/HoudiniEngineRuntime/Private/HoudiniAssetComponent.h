@@ -252,6 +252,9 @@ public:
         /** Return true if cooking is enabled for this component. **/
         bool IsCookingEnabled() const;
 
+        /** Return true if parameters changed too recently to be uploaded. **/
+        bool IsParameterUploadDelayed() const;
+
         /** Start asset instantiation task. **/
         void StartTaskAssetInstantiation( bool bLoadedComponent = false, bool bStartTicking = false );
 
@@ -447,6 +450,13 @@ public:
         /** Called after each cook. **/
         void PostCook( bool bCookError = false );
 
+        /** Build the static meshes whose build was deferred by the last cooks, for at most the given number **/
+        /** of seconds. A negative time budget builds all of them. Returns true once the queue is empty. **/
+        bool BuildDeferredStaticMeshes( double TimeBudget );
+
+        /** Build the given static mesh now if its build was deferred, return true if it was built. **/
+        bool BuildDeferredStaticMesh( UStaticMesh * StaticMesh );
+
         /** Check ourselves over and fix up any errors */
         void SanitizePostLoad();
 
@@ -753,6 +763,15 @@ public:
         /** Component from which this component has been copied. **/
         UHoudiniAssetComponent * CopiedHoudiniComponent;
 
+        /** Static meshes generated by the last cooks which still need to be built. **/
+        TArray< TWeakObjectPtr< UStaticMesh > > DeferredStaticMeshBuilds;
+
+        /** Number of meshes queued since the deferred build queue was last empty, used for progress. **/
+        int32 DeferredStaticMeshBuildCount;
+
+        /** GUID used to report the progress of deferred static mesh builds. **/
+        FGuid DeferredStaticMeshBuildGUID;
+
 #endif
 
         /** Unique GUID created by component. **/
@@ -794,6 +813,9 @@ public:
         /** Used to delay notification updates for HAPI asynchronous work. **/
         double HapiNotificationStarted;
 
+        /** Time of the last parameter change, used to debounce parameter uploads. **/
+        double LastParameterChangeTime;
+
         /** Number of times this asset has been cooked. **/
         int32 AssetCookCount;
 
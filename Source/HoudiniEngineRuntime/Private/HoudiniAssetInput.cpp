@@ -227,6 +227,10 @@ UHoudiniAssetInput::UHoudiniAssetInput( const class FPostConstructInitializeProp
     bExportAllLODs = false;
     bExportSockets = false;
 
+#if WITH_EDITOR
+    bLandscapeTracked = false;
+#endif
+
     ChoiceStringValue = TEXT( "" );
 
     // Initialize the arraysc
@@ -407,6 +411,13 @@ UHoudiniAssetInput::DisconnectAndDestroyInputAsset()
             FHoudiniEngineUtils::DestroyHoudiniAsset( ConnectedAssetId );
 
         ConnectedAssetId = -1;
+
+        // The heightfield volumes have been destroyed along with the input
+        LandscapeHeightfieldState.Reset();
+#if WITH_EDITOR
+        StopLandscapeTracking();
+#endif
+
         if ( ChoiceIndex == EHoudiniAssetInputType::WorldInput )
         {
             // World Input Actors' Meshes need to have their corresponding Input Assets destroyed too.
@@ -820,6 +831,20 @@ UHoudiniAssetInput::UploadParameterValue()
             }
             else
             {
+                // If the whole landscape has been sent as a heightfield, try to only send the components modified since
+                bool bExportWholeHeightfield = bLandscapeExportAsHeightfield && !bLandscapeExportSelectionOnly;
+#if WITH_EDITOR
+                if ( bExportWholeHeightfield && LandscapeHeightfieldState.IsValid()
+                    && ( LandscapeHeightfieldState.Landscape.Get() == InputLandscapeProxy->GetLandscapeActor() )
+                    && FHoudiniEngineUtils::IsHoudiniNodeValid( ConnectedAssetId ) )
+                {
+                    if ( FHoudiniLandscapeUtils::UpdateHeightfieldFromLandscape( LandscapeHeightfieldState ) )
+                        break;
+
+                    HOUDINI_LOG_MESSAGE( TEXT( "Landscape input: the heightfield could not be updated in place, resending the landscape." ) );
+                }
+#endif
+
                 // Disconnect and destroy currently connected asset, if there's one.
                 DisconnectAndDestroyInputAsset();
 
@@ -839,7 +864,8 @@ UHoudiniAssetInput::UploadParameterValue()
                         bLandscapeExportSelectionOnly, bLandscapeExportCurves,
                         bLandscapeExportMaterials, bLandscapeExportAsMesh, bLandscapeExportLighting,
                         bLandscapeExportNormalizedUVs, bLandscapeExportTileUVs, Bounds,
-                        bLandscapeExportAsHeightfield, bLandscapeAutoSelectComponent ) )
+                        bLandscapeExportAsHeightfield, bLandscapeAutoSelectComponent,
+                        bExportWholeHeightfield ? &LandscapeHeightfieldState : nullptr ) )
                 {
                     bChanged = false;
                     ConnectedAssetId = -1;
@@ -849,6 +875,11 @@ UHoudiniAssetInput::UploadParameterValue()
                 // Connect the inputs and update the transform type
                 Success &= ConnectInputNode();
                 Success &= UpdateObjectMergeTransformType();
+
+#if WITH_EDITOR
+                if ( LandscapeHeightfieldState.IsValid() )
+                    StartLandscapeTracking();
+#endif
             }
             break;
         }
@@ -1080,6 +1111,10 @@ UHoudiniAssetInput::BeginDestroy()
 {
     Super::BeginDestroy();
 
+#if WITH_EDITOR
+    StopLandscapeTracking();
+#endif
+
     // Destroy anything curve related.
     DestroyInputCurve();
 
@@ -2004,16 +2039,12 @@ bool
 UHoudiniAssetInput::UpdateInputCurve()
 {
     bool Success = true;
-    FString CurvePointsString;
     EHoudiniSplineComponentType::Enum CurveTypeValue = EHoudiniSplineComponentType::Bezier;
     EHoudiniSplineComponentMethod::Enum CurveMethodValue = EHoudiniSplineComponentMethod::CVs;
     int32 CurveClosed = 1;
 
     if(ConnectedAssetId != -1)
     {
-        FHoudiniEngineUtils::HapiGetParameterDataAsString(
-            ConnectedAssetId, HAPI_UNREAL_PARAM_CURVE_COORDS, TEXT( "" ),
-            CurvePointsString );
         FHoudiniEngineUtils::HapiGetParameterDataAsInteger(
             ConnectedAssetId, HAPI_UNREAL_PARAM_CURVE_TYPE,
             (int32) EHoudiniSplineComponentType::Bezier, (int32 &) CurveTypeValue );
@@ -2042,10 +2073,7 @@ UHoudiniAssetInput::UpdateInputCurve()
         HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_POSITION,
         AttributeRefinedCurvePositions, RefinedCurvePositions );
 
-    // Process coords string and extract positions.
-    TArray< FVector > CurvePoints;
-    FHoudiniEngineUtils::ExtractStringPositions( CurvePointsString, CurvePoints );
-
+    // The curve is rebuilt from the cooked positions, there is no need to parse the coords string.
     TArray< FVector > CurveDisplayPoints;
     FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( RefinedCurvePositions, CurveDisplayPoints );
 
@@ -2770,9 +2798,36 @@ UHoudiniAssetInput::StopWorldOutlinerTicking()
     }
 }
 
+void
+UHoudiniAssetInput::StartLandscapeTracking()
+{
+    if ( !bLandscapeTracked )
+    {
+        FCoreUObjectDelegates::OnObjectModified.AddUObject( this, &UHoudiniAssetInput::OnLandscapeObjectModified );
+        bLandscapeTracked = true;
+    }
+}
+
+void
+UHoudiniAssetInput::StopLandscapeTracking()
+{
+    if ( bLandscapeTracked )
+    {
+        FCoreUObjectDelegates::OnObjectModified.RemoveUObject( this, &UHoudiniAssetInput::OnLandscapeObjectModified );
+        bLandscapeTracked = false;
+    }
+}
+
+void
+UHoudiniAssetInput::OnLandscapeObjectModified( UObject * Object )
+{
+    FHoudiniLandscapeUtils::MarkHeightfieldComponentsDirty( LandscapeHeightfieldState, Object );
+}
+
 void UHoudiniAssetInput::InvalidateNodeIds()
 {
     ConnectedAssetId = -1;
+    LandscapeHeightfieldState.Reset();
     for (auto& OutlinerInputMesh : InputOutlinerMeshArray)
     {
         OutlinerInputMesh.AssetId = -1;
@@ -23,6 +23,7 @@
 
 #pragma once
 #include "HoudiniAssetParameter.h"
+#include "HoudiniLandscapeUtils.h"
 #include "Core.h"
 #include "TimerManager.h"
 #include "GameFramework/Actor.h"
@@ -464,6 +465,15 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Stop world outliner Actor transform monitor ticking. **/
         void StopWorldOutlinerTicking();
 
+        /** Start tracking the landscape components modified after a heightfield upload. **/
+        void StartLandscapeTracking();
+
+        /** Stop tracking the landscape components modified after a heightfield upload. **/
+        void StopLandscapeTracking();
+
+        /** Called when an object is modified, used to find the modified landscape components. **/
+        void OnLandscapeObjectModified( UObject * Object );
+
         /** Set value of the SplineResolution for world outliners, used by Slate. **/
         void SetSplineResolutionValue(float InValue);
 
@@ -526,6 +536,14 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Timer delegate, we use it for ticking to see if input Actors have changed. **/
         FTimerDelegate WorldOutlinerTimerDelegate;
 
+        /** Heightfield volumes of the landscape input and the components modified since their upload. **/
+        FHoudiniLandscapeHeightfieldState LandscapeHeightfieldState;
+
+#if WITH_EDITOR
+        /** Set while the object modification delegate is bound to track the landscape changes. **/
+        bool bLandscapeTracked;
+#endif
+
         float UnrealSplineResolution;
 
         /** Indicates that the OutlinerInputs have just been loaded and needs to be updated **/
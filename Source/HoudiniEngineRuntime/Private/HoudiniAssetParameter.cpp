@@ -155,6 +155,20 @@ UHoudiniAssetParameter::UploadParameterValue()
     return true;
 }
 
+const int32 *
+UHoudiniAssetParameter::GetBatchedIntValues() const
+{
+    // Default implementation uploads on its own.
+    return nullptr;
+}
+
+const float *
+UHoudiniAssetParameter::GetBatchedFloatValues() const
+{
+    // Default implementation uploads on its own.
+    return nullptr;
+}
+
 bool
 UHoudiniAssetParameter::SetParameterVariantValue( const FVariant& Variant, int32 Idx, bool bTriggerModify, bool bRecordUndo )
 {
@@ -423,6 +437,18 @@ UHoudiniAssetParameter::GetTupleSize() const
     return TupleSize;
 }
 
+HAPI_NodeId
+UHoudiniAssetParameter::GetNodeId() const
+{
+    return NodeId;
+}
+
+int32
+UHoudiniAssetParameter::GetValuesIndex() const
+{
+    return ValuesIndex;
+}
+
 bool
 UHoudiniAssetParameter::IsArray() const
 {
@@ -60,6 +60,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameter : public UObject
         /** Upload parameter value to HAPI. **/
         virtual bool UploadParameterValue();
 
+        /** Return the int values uploaded by this parameter, if its upload can be merged with adjacent parameters. **/
+        virtual const int32 * GetBatchedIntValues() const;
+
+        /** Return the float values uploaded by this parameter, if its upload can be merged with adjacent parameters. **/
+        virtual const float * GetBatchedFloatValues() const;
+
         /** Set parameter value. **/
         virtual bool SetParameterVariantValue(
             const FVariant & Variant,
@@ -123,6 +129,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameter : public UObject
         /** Return tuple size. **/
         int32 GetTupleSize() const;
 
+        /** Return node id of this parameter. **/
+        HAPI_NodeId GetNodeId() const;
+
+        /** Return internal value index used by this parameter. **/
+        int32 GetValuesIndex() const;
+
     /** UObject methods. **/
     public:
 
@@ -26,6 +26,7 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniParamUtils.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
 
@@ -90,9 +91,7 @@ UHoudiniAssetParameterChoice::CreateParameter(
         // Assign internal Hapi values index.
         SetValuesIndex( ParmInfo.intValuesIndex );
 
-        if ( FHoudiniApi::GetParmIntValues(
-            FHoudiniEngine::Get().GetSession(), NodeId, &CurrentValue,
-            ValuesIndex, TupleSize) != HAPI_RESULT_SUCCESS )
+        if ( !FHoudiniParamUtils::GetParmIntValues( NodeId, &CurrentValue, ValuesIndex, TupleSize ) )
         {
             return false;
         }
@@ -111,9 +110,7 @@ UHoudiniAssetParameterChoice::CreateParameter(
         SetValuesIndex( ParmInfo.stringValuesIndex );
 
         HAPI_StringHandle StringHandle;
-        if ( FHoudiniApi::GetParmStringValues(
-            FHoudiniEngine::Get().GetSession(), NodeId, false,
-            &StringHandle, ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+        if ( !FHoudiniParamUtils::GetParmStringValues( NodeId, &StringHandle, ValuesIndex, TupleSize ) )
         {
             return false;
         }
@@ -26,6 +26,7 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniParamUtils.h"
 
 #include "Internationalization.h"
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
@@ -93,9 +94,7 @@ UHoudiniAssetParameterColor::CreateParameter(
 
     // Get the actual value for this property.
     Color = FLinearColor::White;
-    if ( FHoudiniApi::GetParmFloatValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId,
-        (float *) &Color.R, ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::GetParmFloatValues( InNodeId, (float *) &Color.R, ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -118,6 +117,12 @@ UHoudiniAssetParameterColor::UploadParameterValue()
     return Super::UploadParameterValue();
 }
 
+const float *
+UHoudiniAssetParameterColor::GetBatchedFloatValues() const
+{
+    return TupleSize <= 4 ? (const float *) &Color.R : nullptr;
+}
+
 bool
 UHoudiniAssetParameterColor::SetParameterVariantValue( const FVariant& Variant, int32 Idx, bool bTriggerModify, bool bRecordUndo )
 {
@@ -27,6 +27,7 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniParamUtils.h"
 #include "HoudiniAsset.h"
 #include "HoudiniEngineString.h"
 
@@ -109,9 +110,7 @@ UHoudiniAssetParameterFile::CreateParameter(
     // Get the actual value for this property.
     TArray< HAPI_StringHandle > StringHandles;
     StringHandles.SetNum( TupleSize );
-    if ( FHoudiniApi::GetParmStringValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, false,
-        &StringHandles[ 0 ], ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::GetParmStringValues( InNodeId, &StringHandles[ 0 ], ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -27,6 +27,7 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniParamUtils.h"
 #include "HoudiniEngineString.h"
 
 #include "Internationalization.h"
@@ -115,9 +116,7 @@ UHoudiniAssetParameterFloat::CreateParameter(
     Values.SetNumZeroed(TupleSize);
 
     // Get the actual value for this property.
-    if ( FHoudiniApi::GetParmFloatValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::GetParmFloatValues( InNodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -200,11 +199,14 @@ UHoudiniAssetParameterFloat::CreateParameter(
         }
     }
 
-    // Get this parameter's unit if it has one
-    FHoudiniEngineUtils::HapiGetParameterUnit( InNodeId, ParmId, ValueUnit );
-
-    // Get this parameter's no swap tag if it has one
-    FHoudiniEngineUtils::HapiGetParameterNoSwapTag( InNodeId, ParmId, NoSwap );
+    // Get this parameter's unit and no swap tag if it has any tags.
+    ValueUnit = TEXT( "" );
+    NoSwap = false;
+    if ( ParmInfo.tagCount > 0 )
+    {
+        FHoudiniEngineUtils::HapiGetParameterUnit( InNodeId, ParmId, ValueUnit );
+        FHoudiniEngineUtils::HapiGetParameterNoSwapTag( InNodeId, ParmId, NoSwap );
+    }
 
     return true;
 }
@@ -221,6 +223,12 @@ UHoudiniAssetParameterFloat::UploadParameterValue()
     return Super::UploadParameterValue();
 }
 
+const float *
+UHoudiniAssetParameterFloat::GetBatchedFloatValues() const
+{
+    return Values.Num() >= TupleSize ? Values.GetData() : nullptr;
+}
+
 bool
 UHoudiniAssetParameterFloat::SetParameterVariantValue( const FVariant & Variant, int32 Idx, bool bTriggerModify, bool bRecordUndo )
 {
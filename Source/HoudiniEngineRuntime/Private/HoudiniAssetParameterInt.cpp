@@ -26,6 +26,7 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniParamUtils.h"
 #include "HoudiniEngineUtils.h"
 
 #include "Internationalization.h"
@@ -90,9 +91,7 @@ UHoudiniAssetParameterInt::CreateParameter(
 		return false;
 	}
 
-    if ( FHoudiniApi::GetParmIntValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::GetParmIntValues( InNodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -141,8 +140,10 @@ UHoudiniAssetParameterInt::CreateParameter(
         }
     }
 
-    // Get this parameter's unit if it has one
-    FHoudiniEngineUtils::HapiGetParameterUnit( InNodeId, ParmId, ValueUnit );
+    // Get this parameter's unit if it has one, parameters without tags can't have a unit.
+    ValueUnit = TEXT( "" );
+    if ( ParmInfo.tagCount > 0 )
+        FHoudiniEngineUtils::HapiGetParameterUnit( InNodeId, ParmId, ValueUnit );
 
     return true;
 }
@@ -160,6 +161,12 @@ UHoudiniAssetParameterInt::UploadParameterValue()
     return Super::UploadParameterValue();
 }
 
+const int32 *
+UHoudiniAssetParameterInt::GetBatchedIntValues() const
+{
+    return Values.Num() >= TupleSize ? Values.GetData() : nullptr;
+}
+
 bool
 UHoudiniAssetParameterInt::SetParameterVariantValue( const FVariant & Variant, int32 Idx, bool bTriggerModify, bool bRecordUndo )
 {
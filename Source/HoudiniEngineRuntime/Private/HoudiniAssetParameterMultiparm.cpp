@@ -26,6 +26,7 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniParamUtils.h"
 #include "HoudiniEngineUtils.h"
 
 #include "Internationalization.h"
@@ -79,11 +80,7 @@ UHoudiniAssetParameterMultiparm::CreateParameter(
 
     // Get the actual value for this property.
     MultiparmValue = 0;
-    HOUDINI_CHECK_ERROR_RETURN(
-        FHoudiniApi::GetParmIntValues( 
-            FHoudiniEngine::Get().GetSession(), InNodeId, &MultiparmValue, ValuesIndex, 1 )
-        , false );
-    return true;
+    return FHoudiniParamUtils::GetParmIntValues( InNodeId, &MultiparmValue, ValuesIndex, 1 );
 }
 
 #if WITH_EDITOR
@@ -26,6 +26,7 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniParamUtils.h"
 
 #include "Internationalization.h"
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
@@ -79,9 +80,7 @@ UHoudiniAssetParameterToggle::CreateParameter(
 
     // Get the actual value for this property.
     Values.SetNumZeroed( TupleSize );
-    if ( FHoudiniApi::GetParmIntValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
+    if ( !FHoudiniParamUtils::GetParmIntValues( InNodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
     {
         return false;
     }
@@ -103,6 +102,12 @@ UHoudiniAssetParameterToggle::UploadParameterValue()
     return Super::UploadParameterValue();
 }
 
+const int32 *
+UHoudiniAssetParameterToggle::GetBatchedIntValues() const
+{
+    return Values.Num() >= TupleSize ? Values.GetData() : nullptr;
+}
+
 bool
 UHoudiniAssetParameterToggle::SetParameterVariantValue(
     const FVariant & Variant, int32 Idx, bool bTriggerModify, bool bRecordUndo )
@@ -55,6 +55,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameterToggle : public UHoudiniAss
         /** Upload parameter value to HAPI. **/
         virtual bool UploadParameterValue() override;
 
+        /** Return the values uploaded by this parameter. **/
+        virtual const int32 * GetBatchedIntValues() const override;
+
         /** Set parameter value. **/
         virtual bool SetParameterVariantValue(
             const FVariant & Variant, int32 Idx = 0, bool bTriggerModify = true,
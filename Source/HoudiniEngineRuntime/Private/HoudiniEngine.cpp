@@ -31,6 +31,12 @@
 #include "HoudiniLandscapeUtils.h"
 #include "HoudiniAsset.h"
 #include "HoudiniRuntimeSettings.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniEngineAttributeDirectory.h"
+#include "HoudiniEngineInputMeshCache.h"
+#include "HoudiniEngineAssetLibraryCache.h"
+#include "HoudiniEngineMockApi.h"
+#include "HoudiniEngineApiProfiler.h"
 
 //#include "PlatformMisc.h"
 //#include "ScopeLock.h"
@@ -52,6 +58,39 @@ DEFINE_LOG_CATEGORY( LogHoudiniEngine );
 FHoudiniEngine *
 FHoudiniEngine::HoudiniEngineInstance = nullptr;
 
+/** Runnable creating the startup session on its own thread, so that module startup does not wait for it. **/
+class FHoudiniEngineSessionStarter : public FRunnable
+{
+    public:
+
+        FHoudiniEngineSessionStarter( FHoudiniEngine & InHoudiniEngine )
+            : HoudiniEngine( InHoudiniEngine )
+        {}
+
+    /** FRunnable methods. **/
+    public:
+
+        virtual uint32 Run() override
+        {
+            HoudiniEngine.SessionStartupThreadId = FPlatformTLS::GetCurrentThreadId();
+
+#if WITH_EDITOR
+            HoudiniEngine.SessionStartupResult.Set( HoudiniEngine.StartupSession() ? 1 : 0 );
+#endif
+
+            // Publish the result before releasing the callers waiting on the session.
+            HoudiniEngine.SessionStartupPending.Reset();
+            HoudiniEngine.SessionStartupEvent->Trigger();
+
+            return 0;
+        }
+
+    protected:
+
+        /** Engine whose session is created. **/
+        FHoudiniEngine & HoudiniEngine;
+};
+
 FHoudiniEngine::FHoudiniEngine()
     : HoudiniLogoStaticMesh( nullptr )
     , HoudiniDefaultMaterial( nullptr )
@@ -59,6 +98,11 @@ FHoudiniEngine::FHoudiniEngine()
     , HoudiniEngineSchedulerThread( nullptr )
     , HoudiniEngineScheduler( nullptr )
     , EnableCookingGlobal( true )
+    , bStartSessionInBackground( false )
+    , SessionStartupThreadId( 0 )
+    , SessionStartupEvent( nullptr )
+    , SessionStartupThread( nullptr )
+    , SessionStarter( nullptr )
 {
     Session.type = HAPI_SESSION_MAX;
     Session.id = -1;
@@ -97,7 +141,7 @@ FHoudiniEngine::GetHoudiniBgeoAsset() const
 bool
 FHoudiniEngine::CheckHapiVersionMismatch() const
 {
-    return bHAPIVersionMismatch;
+    return HAPIVersionMismatch.GetValue() != 0;
 }
 
 const FString &
@@ -121,6 +165,10 @@ FHoudiniEngine::SetHapiState( HAPI_Result Result )
 const HAPI_Session *
 FHoudiniEngine::GetSession() const
 {
+    // Callers arriving while the session is being created in the background wait until it is ready.
+    if ( ( SessionStartupPending.GetValue() != 0 ) && FPlatformTLS::GetCurrentThreadId() != SessionStartupThreadId )
+        WaitForSession();
+
     return Session.type == HAPI_SESSION_MAX ? nullptr : &Session;
 }
 
@@ -131,6 +179,31 @@ FHoudiniEngine::Get()
     return *FHoudiniEngine::HoudiniEngineInstance;
 }
 
+bool
+FHoudiniEngine::IsSessionStarting() const
+{
+    return SessionStartupPending.GetValue() != 0;
+}
+
+bool
+FHoudiniEngine::WaitForSession() const
+{
+    if ( !SessionStartupEvent )
+        return true;
+
+    if ( SessionStartupPending.GetValue() != 0 )
+    {
+        const double WaitStartTime = FPlatformTime::Seconds();
+        SessionStartupEvent->Wait();
+
+        HOUDINI_LOG_MESSAGE(
+            TEXT( "Waited %.3f s for the Houdini Engine session to start." ),
+            FPlatformTime::Seconds() - WaitStartTime );
+    }
+
+    return SessionStartupResult.GetValue() != 0;
+}
+
 bool
 FHoudiniEngine::IsInitialized()
 {
@@ -140,12 +213,14 @@ FHoudiniEngine::IsInitialized()
 void
 FHoudiniEngine::StartupModule()
 {
-    bHAPIVersionMismatch = false;
+    HAPIVersionMismatch.Reset();
     HAPIState = HAPI_RESULT_NOT_INITIALIZED;
 
     HOUDINI_LOG_MESSAGE( TEXT( "Starting the Houdini Engine module." ) );
 
 #if WITH_EDITOR
+    const double ModuleStartupTime = FPlatformTime::Seconds();
+
     // Register settings.
     if( ISettingsModule * SettingsModule = FModuleManager::GetModulePtr< ISettingsModule >( "Settings" ) )
     {
@@ -156,13 +231,22 @@ FHoudiniEngine::StartupModule()
             GetMutableDefault< UHoudiniRuntimeSettings >() );
     }
 
-    // Before starting the module, we need to locate and load HAPI library.
+    // Before starting the module, we need to locate and load HAPI library, unless the synthetic
+    // backend was requested for headless profiling.
+    if ( FHoudiniEngineMockApi::IsRequested() )
+    {
+        FHoudiniEngineMockApiSettings MockApiSettings;
+        MockApiSettings.ParseCommandLine( FCommandLine::Get() );
+        FHoudiniEngineMockApi::Bind( MockApiSettings );
+    }
+    else
     {
         void * HAPILibraryHandle = FHoudiniEngineUtils::LoadLibHAPI( LibHAPILocation );
 
         if ( HAPILibraryHandle )
         {
             FHoudiniApi::InitializeHAPI( HAPILibraryHandle );
+            HOUDINI_LOG_MESSAGE( TEXT( "Loaded libHAPI in %.3f s." ), FPlatformTime::Seconds() - ModuleStartupTime );
         }
         else
         {
@@ -172,6 +256,8 @@ FHoudiniEngine::StartupModule()
         }
     }
 
+    FHoudiniEngineApiProfiler::RegisterConsoleCommands();
+
 #endif
 
     // Create static mesh Houdini logo.
@@ -228,176 +314,237 @@ FHoudiniEngine::StartupModule()
     // Build and running versions match, we can perform HAPI initialization.
     if ( FHoudiniApi::IsHAPIInitialized() )
     {
+        // Install the profiling probes first, so that session startup is accounted for.
+        if ( FHoudiniEngineApiProfiler::IsRequested() )
+            FHoudiniEngineApiProfiler::Enable();
+
         const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
-        HAPI_Result SessionResult = HAPI_RESULT_FAILURE;
+        // The session is created once the module is fully started, on a background thread if requested.
+        bStartSessionInBackground = HoudiniRuntimeSettings->bStartSessionInBackground && FPlatformProcess::SupportsMultithreading();
 
-        HAPI_ThriftServerOptions ServerOptions;
-        FMemory::Memzero< HAPI_ThriftServerOptions >( ServerOptions );
-        ServerOptions.autoClose = true;
-        ServerOptions.timeoutMs = HoudiniRuntimeSettings->AutomaticServerTimeout;
+        // Create HAPI scheduler and processing thread.
+        HoudiniEngineScheduler = new FHoudiniEngineScheduler();
+        HoudiniEngineSchedulerThread = FRunnableThread::Create(
+            HoudiniEngineScheduler, TEXT( "HoudiniTaskCookAsset" ), 0, TPri_Normal );
 
-        auto UpdatePathForServer = [&] {
-            // Modify our PATH so that HARC will find HARS.exe
-            const TCHAR* PathDelimiter = FPlatformMisc::GetPathVarDelimiter();
-            const int32 MaxPathVarLen = 32768;
-            TCHAR OrigPathVarMem[ MaxPathVarLen ];
-            FPlatformMisc::GetEnvironmentVariable( TEXT( "PATH" ), OrigPathVarMem, MaxPathVarLen );
-            FString OrigPathVar( OrigPathVarMem );
+        // Set the default value for pausing houdini engine cooking
+        EnableCookingGlobal = !HoudiniRuntimeSettings->bPauseCookingOnStart;
+    }
 
-            FString ModifiedPath =
-#if PLATFORM_MAC
-            // On Mac our binaries are split between two folders
-            LibHAPILocation + TEXT( "/../Resources/bin" ) + PathDelimiter +
 #endif
-            LibHAPILocation + PathDelimiter + OrigPathVar;
 
-            FPlatformMisc::SetEnvironmentVar( TEXT( "PATH" ), *ModifiedPath );
-        };
+    // Store the instance.
+    FHoudiniEngine::HoudiniEngineInstance = this;
 
-		//JC: runtime settings type is hardcoded. FIX THIS
-        //switch ( HoudiniRuntimeSettings->SessionType.GetValue() )
+#if WITH_EDITOR
 
-		EHoudiniRuntimeSettingsSessionType sessionType = EHoudiniRuntimeSettingsSessionType::HRSST_Socket;
-		switch ( sessionType )
+    if ( FHoudiniApi::IsHAPIInitialized() )
+    {
+        if ( bStartSessionInBackground )
         {
-            case EHoudiniRuntimeSettingsSessionType::HRSST_InProcess:
-            {
-                SessionResult = FHoudiniApi::CreateInProcessSession( &this->Session );
-#if PLATFORM_WINDOWS
-                // Workaround for Houdini libtools setting stdout to binary
-                FWindowsPlatformMisc::SetUTF8Output();
+            // Components instantiated before the session is ready wait on the event, see WaitForSession.
+            // The event is manual reset, so it keeps releasing callers once the startup is over.
+            SessionStartupPending.Set( 1 );
+            SessionStartupEvent = FPlatformProcess::CreateSynchEvent( true );
+            SessionStarter = new FHoudiniEngineSessionStarter( *this );
+            SessionStartupThread = FRunnableThread::Create(
+                SessionStarter, TEXT( "HoudiniSessionStartup" ), 0, TPri_Normal );
+
+            // Without a thread, create the session here rather than leave its callers waiting.
+            if ( !SessionStartupThread )
+                SessionStarter->Run();
+        }
+        else
+        {
+            StartupSession();
+        }
+    }
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Houdini Engine module started in %.3f s%s." ),
+        FPlatformTime::Seconds() - ModuleStartupTime,
+        bStartSessionInBackground ? TEXT( ", the session is being created in the background" ) : TEXT( "" ) );
+
 #endif
-                break;
-            }
+}
 
-            case EHoudiniRuntimeSettingsSessionType::HRSST_Socket:
-            {
-                if ( HoudiniRuntimeSettings->bStartAutomaticServer )
-                {
-                    UpdatePathForServer();
+#if WITH_EDITOR
 
-                    FHoudiniApi::StartThriftSocketServer( &ServerOptions, HoudiniRuntimeSettings->ServerPort, nullptr );
-                }
+bool
+FHoudiniEngine::StartupSession()
+{
+    const double SessionStartTime = FPlatformTime::Seconds();
 
-                SessionResult = FHoudiniApi::CreateThriftSocketSession(
-                    &this->Session,
-                    TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerHost ),
-                    HoudiniRuntimeSettings->ServerPort );
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
-                break;
-            }
+    HAPI_Result SessionResult = HAPI_RESULT_FAILURE;
 
-            case EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe:
-            {
-                if ( HoudiniRuntimeSettings->bStartAutomaticServer )
-                {
-                    UpdatePathForServer();
+    HAPI_ThriftServerOptions ServerOptions;
+    FMemory::Memzero< HAPI_ThriftServerOptions >( ServerOptions );
+    ServerOptions.autoClose = true;
+    ServerOptions.timeoutMs = HoudiniRuntimeSettings->AutomaticServerTimeout;
 
-                    FHoudiniApi::StartThriftNamedPipeServer(
-                        &ServerOptions,
-                        TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ),
-                        nullptr );
-                }
+    auto UpdatePathForServer = [&] {
+        // Modify our PATH so that HARC will find HARS.exe
+        const TCHAR* PathDelimiter = FPlatformMisc::GetPathVarDelimiter();
+        const int32 MaxPathVarLen = 32768;
+        TCHAR OrigPathVarMem[ MaxPathVarLen ];
+        FPlatformMisc::GetEnvironmentVariable( TEXT( "PATH" ), OrigPathVarMem, MaxPathVarLen );
+        FString OrigPathVar( OrigPathVarMem );
 
-                SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
-                    &this->Session, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ) );
+        FString ModifiedPath =
+#if PLATFORM_MAC
+        // On Mac our binaries are split between two folders
+        LibHAPILocation + TEXT( "/../Resources/bin" ) + PathDelimiter +
+#endif
+        LibHAPILocation + PathDelimiter + OrigPathVar;
 
-                break;
-            }
+        FPlatformMisc::SetEnvironmentVar( TEXT( "PATH" ), *ModifiedPath );
+    };
 
-            default:
+	//JC: runtime settings type is hardcoded. FIX THIS
+    //switch ( HoudiniRuntimeSettings->SessionType.GetValue() )
 
-                HOUDINI_LOG_ERROR( TEXT( "Unsupported Houdini Engine session type" ) );
+	EHoudiniRuntimeSettingsSessionType sessionType = EHoudiniRuntimeSettingsSessionType::HRSST_Socket;
+	switch ( sessionType )
+    {
+        case EHoudiniRuntimeSettingsSessionType::HRSST_InProcess:
+        {
+            SessionResult = FHoudiniApi::CreateInProcessSession( &this->Session );
+#if PLATFORM_WINDOWS
+            // Workaround for Houdini libtools setting stdout to binary
+            FWindowsPlatformMisc::SetUTF8Output();
+#endif
+            break;
         }
 
-        const HAPI_Session * SessionPtr = GetSession();
-        if ( SessionResult != HAPI_RESULT_SUCCESS || !SessionPtr )
+        case EHoudiniRuntimeSettingsSessionType::HRSST_Socket:
         {
-            if ( ( HoudiniRuntimeSettings->SessionType.GetValue() == EHoudiniRuntimeSettingsSessionType::HRSST_Socket ||
-                HoudiniRuntimeSettings->SessionType.GetValue() == EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe ) &&
-                ! HoudiniRuntimeSettings->bStartAutomaticServer )
+            if ( HoudiniRuntimeSettings->bStartAutomaticServer )
             {
-                HOUDINI_LOG_ERROR( TEXT( "Failed to create a Houdini Engine session.  Check that a Houdini Engine Debugger session or HARS server is running" ) );
+                UpdatePathForServer();
+
+                FHoudiniApi::StartThriftSocketServer( &ServerOptions, HoudiniRuntimeSettings->ServerPort, nullptr );
             }
-            else
+
+            SessionResult = FHoudiniApi::CreateThriftSocketSession(
+                &this->Session,
+                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerHost ),
+                HoudiniRuntimeSettings->ServerPort );
+
+            break;
+        }
+
+        case EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe:
+        {
+            if ( HoudiniRuntimeSettings->bStartAutomaticServer )
             {
-                HOUDINI_LOG_ERROR( TEXT( "Failed to create a Houdini Engine session" ) );
+                UpdatePathForServer();
+
+                FHoudiniApi::StartThriftNamedPipeServer(
+                    &ServerOptions,
+                    TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ),
+                    nullptr );
             }
+
+            SessionResult = FHoudiniApi::CreateThriftNamedPipeSession(
+                &this->Session, TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ServerPipeName ) );
+
+            break;
         }
 
-        // We need to make sure HAPI version is correct.
-        int32 RunningEngineMajor = 0;
-        int32 RunningEngineMinor = 0;
-        int32 RunningEngineApi = 0;
+        default:
+
+            HOUDINI_LOG_ERROR( TEXT( "Unsupported Houdini Engine session type" ) );
+    }
 
-        // Retrieve version numbers for running Houdini Engine.
-        FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MAJOR, &RunningEngineMajor );
-        FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MINOR, &RunningEngineMinor );
-        FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_API, &RunningEngineApi );
+    const double SessionCreatedTime = FPlatformTime::Seconds();
+    bool bInitialized = false;
 
-        // Compare defined and running versions.
-        if ( RunningEngineMajor == HAPI_VERSION_HOUDINI_ENGINE_MAJOR &&
-           RunningEngineMinor == HAPI_VERSION_HOUDINI_ENGINE_MINOR &&
-           RunningEngineApi == HAPI_VERSION_HOUDINI_ENGINE_API )
+    const HAPI_Session * SessionPtr = GetSession();
+    if ( SessionResult != HAPI_RESULT_SUCCESS || !SessionPtr )
+    {
+        if ( ( HoudiniRuntimeSettings->SessionType.GetValue() == EHoudiniRuntimeSettingsSessionType::HRSST_Socket ||
+            HoudiniRuntimeSettings->SessionType.GetValue() == EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe ) &&
+            ! HoudiniRuntimeSettings->bStartAutomaticServer )
         {
-            HAPI_CookOptions CookOptions;
-            FMemory::Memzero< HAPI_CookOptions >( CookOptions );
-            CookOptions.curveRefineLOD = 8.0f;
-            CookOptions.clearErrorsAndWarnings = false;
-            CookOptions.maxVerticesPerPrimitive = 3;
-            CookOptions.splitGeosByGroup = false;
-            CookOptions.refineCurveToLinear = true;
-            CookOptions.handleBoxPartTypes = false;
-            CookOptions.handleSpherePartTypes = false;
-            CookOptions.splitPointsByVertexAttributes = false;
-            CookOptions.packedPrimInstancingMode = HAPI_PACKEDPRIM_INSTANCING_MODE_FLAT;
-
-            HAPI_Result Result = FHoudiniApi::Initialize( SessionPtr, &CookOptions, true,
-                HoudiniRuntimeSettings->CookingThreadStackSize, 
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->OtlSearchPath), 
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->DsoSearchPath),
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ImageDsoSearchPath), 
-                TCHAR_TO_UTF8( *HoudiniRuntimeSettings->AudioDsoSearchPath) );
-            if ( Result == HAPI_RESULT_SUCCESS )
-            {
-                HOUDINI_LOG_MESSAGE( TEXT( "Successfully intialized the Houdini Engine API module." ) );
-                FHoudiniApi::SetServerEnvString( SessionPtr, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME );
-            }
-            else
-            {
-                HOUDINI_LOG_MESSAGE(
-                    TEXT( "Starting up the Houdini Engine API module failed: %s" ),
-                    *FHoudiniEngineUtils::GetErrorDescription( Result ) );
-            }
+            HOUDINI_LOG_ERROR( TEXT( "Failed to create a Houdini Engine session.  Check that a Houdini Engine Debugger session or HARS server is running" ) );
         }
         else
         {
-            bHAPIVersionMismatch = true;
+            HOUDINI_LOG_ERROR( TEXT( "Failed to create a Houdini Engine session" ) );
+        }
+    }
 
-            HOUDINI_LOG_MESSAGE( TEXT( "Starting up the Houdini Engine API module failed: build and running versions do not match." ) );
+    // We need to make sure HAPI version is correct.
+    int32 RunningEngineMajor = 0;
+    int32 RunningEngineMinor = 0;
+    int32 RunningEngineApi = 0;
+
+    // Retrieve version numbers for running Houdini Engine.
+    FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MAJOR, &RunningEngineMajor );
+    FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MINOR, &RunningEngineMinor );
+    FHoudiniApi::GetEnvInt( HAPI_ENVINT_VERSION_HOUDINI_ENGINE_API, &RunningEngineApi );
+
+    // Compare defined and running versions.
+    if ( RunningEngineMajor == HAPI_VERSION_HOUDINI_ENGINE_MAJOR &&
+       RunningEngineMinor == HAPI_VERSION_HOUDINI_ENGINE_MINOR &&
+       RunningEngineApi == HAPI_VERSION_HOUDINI_ENGINE_API )
+    {
+        HAPI_CookOptions CookOptions;
+        FMemory::Memzero< HAPI_CookOptions >( CookOptions );
+        CookOptions.curveRefineLOD = 8.0f;
+        CookOptions.clearErrorsAndWarnings = false;
+        CookOptions.maxVerticesPerPrimitive = 3;
+        CookOptions.splitGeosByGroup = false;
+        CookOptions.refineCurveToLinear = true;
+        CookOptions.handleBoxPartTypes = false;
+        CookOptions.handleSpherePartTypes = false;
+        CookOptions.splitPointsByVertexAttributes = false;
+        CookOptions.packedPrimInstancingMode = HAPI_PACKEDPRIM_INSTANCING_MODE_FLAT;
+
+        HAPI_Result Result = FHoudiniApi::Initialize( SessionPtr, &CookOptions, true,
+            HoudiniRuntimeSettings->CookingThreadStackSize, 
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->HoudiniEnvironmentFiles),
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->OtlSearchPath), 
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->DsoSearchPath),
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->ImageDsoSearchPath), 
+            TCHAR_TO_UTF8( *HoudiniRuntimeSettings->AudioDsoSearchPath) );
+        if ( Result == HAPI_RESULT_SUCCESS )
+        {
+            bInitialized = true;
+            HOUDINI_LOG_MESSAGE( TEXT( "Successfully intialized the Houdini Engine API module." ) );
+            FHoudiniApi::SetServerEnvString( SessionPtr, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME );
+        }
+        else
+        {
             HOUDINI_LOG_MESSAGE(
-                TEXT( "Defined version: %d.%d.api:%d vs Running version: %d.%d.api:%d" ),
-                HAPI_VERSION_HOUDINI_ENGINE_MAJOR, HAPI_VERSION_HOUDINI_ENGINE_MINOR, HAPI_VERSION_HOUDINI_ENGINE_API,
-                RunningEngineMajor, RunningEngineMinor, RunningEngineApi );
+                TEXT( "Starting up the Houdini Engine API module failed: %s" ),
+                *FHoudiniEngineUtils::GetErrorDescription( Result ) );
         }
+    }
+    else
+    {
+        HAPIVersionMismatch.Set( 1 );
 
-        // Create HAPI scheduler and processing thread.
-        HoudiniEngineScheduler = new FHoudiniEngineScheduler();
-        HoudiniEngineSchedulerThread = FRunnableThread::Create(
-            HoudiniEngineScheduler, TEXT( "HoudiniTaskCookAsset" ), 0, TPri_Normal );
-
-        // Set the default value for pausing houdini engine cooking
-        EnableCookingGlobal = !HoudiniRuntimeSettings->bPauseCookingOnStart;
+        HOUDINI_LOG_MESSAGE( TEXT( "Starting up the Houdini Engine API module failed: build and running versions do not match." ) );
+        HOUDINI_LOG_MESSAGE(
+            TEXT( "Defined version: %d.%d.api:%d vs Running version: %d.%d.api:%d" ),
+            HAPI_VERSION_HOUDINI_ENGINE_MAJOR, HAPI_VERSION_HOUDINI_ENGINE_MINOR, HAPI_VERSION_HOUDINI_ENGINE_API,
+            RunningEngineMajor, RunningEngineMinor, RunningEngineApi );
     }
 
-#endif
+    const double SessionEndTime = FPlatformTime::Seconds();
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Houdini Engine session startup took %.3f s (session creation %.3f s, initialization %.3f s)." ),
+        SessionEndTime - SessionStartTime, SessionCreatedTime - SessionStartTime, SessionEndTime - SessionCreatedTime );
 
-    // Store the instance.
-    FHoudiniEngine::HoudiniEngineInstance = this;
+    return bInitialized;
 }
 
+#endif
+
 void
 FHoudiniEngine::ShutdownModule()
 {
@@ -431,6 +578,29 @@ FHoudiniEngine::ShutdownModule()
         SettingsModule->UnregisterSettings( "Project", "Plugins", "HoudiniEngine" );
 #endif
 
+    // The session may still be starting in the background.
+    WaitForSession();
+
+    if ( SessionStartupThread )
+    {
+        SessionStartupThread->WaitForCompletion();
+
+        delete SessionStartupThread;
+        SessionStartupThread = nullptr;
+    }
+
+    if ( SessionStarter )
+    {
+        delete SessionStarter;
+        SessionStarter = nullptr;
+    }
+
+    if ( SessionStartupEvent )
+    {
+        delete SessionStartupEvent;
+        SessionStartupEvent = nullptr;
+    }
+
     // Do scheduler and thread clean up.
     if ( HoudiniEngineScheduler )
         HoudiniEngineScheduler->Stop();
@@ -451,10 +621,20 @@ FHoudiniEngine::ShutdownModule()
     }
 
     // Perform HAPI finalization.
+    FHoudiniEngineApiProfiler::Disable();
+
     if ( FHoudiniApi::IsHAPIInitialized() )
         FHoudiniApi::Cleanup( GetSession() );
 
-    FHoudiniApi::FinalizeHAPI();
+#if WITH_EDITOR
+    // Release the conversion buffers kept for input mesh uploads.
+    FHoudiniEngineUtils::FreeInputMeshStagingBuffers();
+#endif
+
+    if ( FHoudiniEngineMockApi::IsBound() )
+        FHoudiniEngineMockApi::Unbind();
+    else
+        FHoudiniApi::FinalizeHAPI();
 }
 
 void
@@ -677,7 +857,7 @@ FHoudiniEngine::StartSession( HAPI_Session*& SessionPtr )
         || RunningEngineMinor != HAPI_VERSION_HOUDINI_ENGINE_MINOR
         || RunningEngineApi != HAPI_VERSION_HOUDINI_ENGINE_API )
     {
-        bHAPIVersionMismatch = true;
+        HAPIVersionMismatch.Set( 1 );
 
         HOUDINI_LOG_MESSAGE(TEXT("Starting up the Houdini Engine API module failed: build and running versions do not match."));
         HOUDINI_LOG_MESSAGE(
@@ -731,6 +911,12 @@ FHoudiniEngine::StopSession( HAPI_Session*& SessionPtr )
     if ( !FHoudiniApi::IsHAPIInitialized() )
         return false;
 
+    // Strings, attribute directories, shared input nodes and loaded libraries from the previous session are no longer valid.
+    FHoudiniEngineStringCache::Reset();
+    FHoudiniEngineAttributeDirectory::Reset();
+    FHoudiniEngineInputMeshCache::Reset();
+    FHoudiniEngineAssetLibraryCache::Reset();
+
     if ( HAPI_RESULT_SUCCESS == FHoudiniApi::IsSessionValid( SessionPtr ) )
     {
         // SessionPtr is valid, clean up and close the session
@@ -744,6 +930,9 @@ FHoudiniEngine::StopSession( HAPI_Session*& SessionPtr )
 bool
 FHoudiniEngine::RestartSession()
 {
+    // Let the startup session finish before replacing it.
+    WaitForSession();
+
     HAPI_Session* SessionPtr = &Session;
     if ( !StopSession( SessionPtr ) )
         return false;
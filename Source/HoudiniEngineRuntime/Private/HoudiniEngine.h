@@ -25,14 +25,18 @@
 
 #include "IHoudiniEngine.h"
 #include "HoudiniEngineTaskInfo.h"
+#include "ThreadingBase.h"
 
 
 class UStaticMesh;
 class FRunnableThread;
 class FHoudiniEngineScheduler;
+class FHoudiniEngineSessionStarter;
 
 class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
 {
+    friend class FHoudiniEngineSessionStarter;
+
     public:
         FHoudiniEngine();
 
@@ -76,6 +80,12 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         void SetEnableCookingGlobal(const bool& enableCooking);
         bool GetEnableCookingGlobal();
 
+        /** Return true while the session is being created in the background. **/
+        bool IsSessionStarting() const;
+
+        /** Block until the background session startup is over, return false if it failed. **/
+        bool WaitForSession() const;
+
         bool StartSession( HAPI_Session*& SessionPtr );
         bool StopSession( HAPI_Session*& SessionPtr );
         bool RestartSession();
@@ -95,6 +105,15 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
 
     private:
 
+#if WITH_EDITOR
+
+        /** Create and initialize the session used at module startup, return true on success. **/
+        bool StartupSession();
+
+#endif
+
+    private:
+
         /** Singleton instance of Houdini Engine. **/
         static FHoudiniEngine * HoudiniEngineInstance;
 
@@ -134,12 +153,32 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         /** Keep current state of HAPI. **/
         HAPI_Result HAPIState;
 
-        /** Is set to true when mismatch between defined and running HAPI versions is detected. **/
-        bool bHAPIVersionMismatch;
+        /** Is set to 1 when mismatch between defined and running HAPI versions is detected, may be set by the **/
+        /** session startup thread. **/
+        FThreadSafeCounter HAPIVersionMismatch;
 
         /** The Houdini Engine session. **/
         HAPI_Session Session;
 
         /** Global cooking flag, used to pause HEngine while using the editor **/
         bool EnableCookingGlobal;
+
+        /** Is set to true when the startup session is created on a background thread. **/
+        bool bStartSessionInBackground;
+
+        /** Set to 1 while the startup session is being created in the background. **/
+        FThreadSafeCounter SessionStartupPending;
+
+        /** Result of the background session startup, 1 on success. **/
+        FThreadSafeCounter SessionStartupResult;
+
+        /** Id of the thread creating the startup session, which must not wait on itself. **/
+        volatile uint32 SessionStartupThreadId;
+
+        /** Event triggered once the background session startup is over. **/
+        FEvent * SessionStartupEvent;
+
+        /** Thread used to create the startup session, and its runnable. **/
+        FRunnableThread * SessionStartupThread;
+        FHoudiniEngineSessionStarter * SessionStarter;
 };
@@ -0,0 +1,846 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineApiProfiler.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniEngineUtils.h"
+
+DECLARE_CYCLE_STAT( TEXT( "Houdini: HAPI Calls" ), STAT_HapiCalls, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "Houdini: HAPI Call Count" ), STAT_HapiCallCount, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "Houdini: HAPI Failed Call Count" ), STAT_HapiFailedCallCount, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "Houdini: HAPI Bytes Transferred" ), STAT_HapiBytes, STATGROUP_HoudiniEngine );
+
+/** Profiled entry points, IsInitialized is left alone as FHoudiniApi::IsHAPIInitialized compares it to its stub. **/
+#define HOUDINI_API_PROFILED_ENTRIES( ENTRY ) \
+    ENTRY( AddAttribute ) \
+    ENTRY( AddGroup ) \
+    ENTRY( BindCustomImplementation ) \
+    ENTRY( CheckForSpecificErrors ) \
+    ENTRY( Cleanup ) \
+    ENTRY( CloseSession ) \
+    ENTRY( CommitGeo ) \
+    ENTRY( ComposeChildNodeList ) \
+    ENTRY( ComposeNodeCookResult ) \
+    ENTRY( ComposeObjectList ) \
+    ENTRY( ConnectNodeInput ) \
+    ENTRY( ConvertMatrixToEuler ) \
+    ENTRY( ConvertMatrixToQuat ) \
+    ENTRY( ConvertTransform ) \
+    ENTRY( ConvertTransformEulerToMatrix ) \
+    ENTRY( ConvertTransformQuatToMatrix ) \
+    ENTRY( CookNode ) \
+    ENTRY( CreateCustomSession ) \
+    ENTRY( CreateInProcessSession ) \
+    ENTRY( CreateInputNode ) \
+    ENTRY( CreateNode ) \
+    ENTRY( CreateThriftNamedPipeSession ) \
+    ENTRY( CreateThriftSocketSession ) \
+    ENTRY( DeleteNode ) \
+    ENTRY( DisconnectNodeInput ) \
+    ENTRY( ExtractImageToFile ) \
+    ENTRY( ExtractImageToMemory ) \
+    ENTRY( GetActiveCacheCount ) \
+    ENTRY( GetActiveCacheNames ) \
+    ENTRY( GetAssetInfo ) \
+    ENTRY( GetAttributeFloatData ) \
+    ENTRY( GetAttributeInfo ) \
+    ENTRY( GetAttributeIntData ) \
+    ENTRY( GetAttributeNames ) \
+    ENTRY( GetAttributeStringData ) \
+    ENTRY( GetAvailableAssetCount ) \
+    ENTRY( GetAvailableAssets ) \
+    ENTRY( GetBoxInfo ) \
+    ENTRY( GetCacheProperty ) \
+    ENTRY( GetComposedChildNodeList ) \
+    ENTRY( GetComposedNodeCookResult ) \
+    ENTRY( GetComposedObjectList ) \
+    ENTRY( GetComposedObjectTransforms ) \
+    ENTRY( GetCookingCurrentCount ) \
+    ENTRY( GetCookingTotalCount ) \
+    ENTRY( GetCurveCounts ) \
+    ENTRY( GetCurveInfo ) \
+    ENTRY( GetCurveKnots ) \
+    ENTRY( GetCurveOrders ) \
+    ENTRY( GetDisplayGeoInfo ) \
+    ENTRY( GetEnvInt ) \
+    ENTRY( GetFaceCounts ) \
+    ENTRY( GetFirstVolumeTile ) \
+    ENTRY( GetGeoInfo ) \
+    ENTRY( GetGeoSize ) \
+    ENTRY( GetGroupCountOnPackedInstancePart ) \
+    ENTRY( GetGroupMembership ) \
+    ENTRY( GetGroupMembershipOnPackedInstancePart ) \
+    ENTRY( GetGroupNames ) \
+    ENTRY( GetGroupNamesOnPackedInstancePart ) \
+    ENTRY( GetHandleBindingInfo ) \
+    ENTRY( GetHandleInfo ) \
+    ENTRY( GetHeightFieldData ) \
+    ENTRY( GetImageInfo ) \
+    ENTRY( GetImageMemoryBuffer ) \
+    ENTRY( GetImagePlaneCount ) \
+    ENTRY( GetImagePlanes ) \
+    ENTRY( GetInstanceTransforms ) \
+    ENTRY( GetInstancedObjectIds ) \
+    ENTRY( GetInstancedPartIds ) \
+    ENTRY( GetInstancerPartTransforms ) \
+    ENTRY( GetManagerNodeId ) \
+    ENTRY( GetMaterialInfo ) \
+    ENTRY( GetMaterialNodeIdsOnFaces ) \
+    ENTRY( GetNextVolumeTile ) \
+    ENTRY( GetNodeInfo ) \
+    ENTRY( GetNodeInputName ) \
+    ENTRY( GetNodePath ) \
+    ENTRY( GetObjectInfo ) \
+    ENTRY( GetObjectTransform ) \
+    ENTRY( GetParameters ) \
+    ENTRY( GetParmChoiceLists ) \
+    ENTRY( GetParmFile ) \
+    ENTRY( GetParmFloatValue ) \
+    ENTRY( GetParmFloatValues ) \
+    ENTRY( GetParmIdFromName ) \
+    ENTRY( GetParmInfo ) \
+    ENTRY( GetParmInfoFromName ) \
+    ENTRY( GetParmIntValue ) \
+    ENTRY( GetParmIntValues ) \
+    ENTRY( GetParmNodeValue ) \
+    ENTRY( GetParmStringValue ) \
+    ENTRY( GetParmStringValues ) \
+    ENTRY( GetParmTagName ) \
+    ENTRY( GetParmTagValue ) \
+    ENTRY( GetParmWithTag ) \
+    ENTRY( GetPartInfo ) \
+    ENTRY( GetPreset ) \
+    ENTRY( GetPresetBufLength ) \
+    ENTRY( GetServerEnvInt ) \
+    ENTRY( GetServerEnvString ) \
+    ENTRY( GetSessionEnvInt ) \
+    ENTRY( GetSphereInfo ) \
+    ENTRY( GetStatus ) \
+    ENTRY( GetStatusString ) \
+    ENTRY( GetStatusStringBufLength ) \
+    ENTRY( GetString ) \
+    ENTRY( GetStringBufLength ) \
+    ENTRY( GetSupportedImageFileFormatCount ) \
+    ENTRY( GetSupportedImageFileFormats ) \
+    ENTRY( GetTime ) \
+    ENTRY( GetTimelineOptions ) \
+    ENTRY( GetVertexList ) \
+    ENTRY( GetVolumeBounds ) \
+    ENTRY( GetVolumeInfo ) \
+    ENTRY( GetVolumeTileFloatData ) \
+    ENTRY( GetVolumeTileIntData ) \
+    ENTRY( GetVolumeVoxelFloatData ) \
+    ENTRY( GetVolumeVoxelIntData ) \
+    ENTRY( Initialize ) \
+    ENTRY( InsertMultiparmInstance ) \
+    ENTRY( Interrupt ) \
+    ENTRY( IsNodeValid ) \
+    ENTRY( IsSessionValid ) \
+    ENTRY( LoadAssetLibraryFromFile ) \
+    ENTRY( LoadAssetLibraryFromMemory ) \
+    ENTRY( LoadGeoFromFile ) \
+    ENTRY( LoadGeoFromMemory ) \
+    ENTRY( LoadHIPFile ) \
+    ENTRY( ParmHasTag ) \
+    ENTRY( PythonThreadInterpreterLock ) \
+    ENTRY( QueryNodeInput ) \
+    ENTRY( RemoveMultiparmInstance ) \
+    ENTRY( RenameNode ) \
+    ENTRY( RenderCOPToImage ) \
+    ENTRY( RenderTextureToImage ) \
+    ENTRY( ResetSimulation ) \
+    ENTRY( RevertGeo ) \
+    ENTRY( SaveGeoToFile ) \
+    ENTRY( SaveGeoToMemory ) \
+    ENTRY( SaveHIPFile ) \
+    ENTRY( SetAnimCurve ) \
+    ENTRY( SetAttributeFloatData ) \
+    ENTRY( SetAttributeIntData ) \
+    ENTRY( SetAttributeStringData ) \
+    ENTRY( SetCacheProperty ) \
+    ENTRY( SetCurveCounts ) \
+    ENTRY( SetCurveInfo ) \
+    ENTRY( SetCurveKnots ) \
+    ENTRY( SetCurveOrders ) \
+    ENTRY( SetFaceCounts ) \
+    ENTRY( SetGroupMembership ) \
+    ENTRY( SetHeightFieldData ) \
+    ENTRY( SetImageInfo ) \
+    ENTRY( SetObjectTransform ) \
+    ENTRY( SetParmFloatValue ) \
+    ENTRY( SetParmFloatValues ) \
+    ENTRY( SetParmIntValue ) \
+    ENTRY( SetParmIntValues ) \
+    ENTRY( SetParmNodeValue ) \
+    ENTRY( SetParmStringValue ) \
+    ENTRY( SetPartInfo ) \
+    ENTRY( SetPreset ) \
+    ENTRY( SetServerEnvInt ) \
+    ENTRY( SetServerEnvString ) \
+    ENTRY( SetTime ) \
+    ENTRY( SetTimelineOptions ) \
+    ENTRY( SetTransformAnimCurve ) \
+    ENTRY( SetVertexList ) \
+    ENTRY( SetVolumeInfo ) \
+    ENTRY( SetVolumeTileFloatData ) \
+    ENTRY( SetVolumeTileIntData ) \
+    ENTRY( SetVolumeVoxelFloatData ) \
+    ENTRY( SetVolumeVoxelIntData ) \
+    ENTRY( StartThriftNamedPipeServer ) \
+    ENTRY( StartThriftSocketServer )
+
+enum EHoudiniApiProfiledEntry
+{
+#define HOUDINI_API_ENTRY_INDEX( Name ) HoudiniApiEntry_##Name,
+    HOUDINI_API_PROFILED_ENTRIES( HOUDINI_API_ENTRY_INDEX )
+#undef HOUDINI_API_ENTRY_INDEX
+
+    HoudiniApiEntry_Count
+};
+
+static const TCHAR *
+HoudiniApiEntryNames[] =
+{
+#define HOUDINI_API_ENTRY_NAME( Name ) TEXT( #Name ),
+    HOUDINI_API_PROFILED_ENTRIES( HOUDINI_API_ENTRY_NAME )
+#undef HOUDINI_API_ENTRY_NAME
+};
+
+/** Bytes copied in or out by a call, zero unless specialized for an array entry point below. **/
+template < int32 EntryIndex >
+struct THoudiniApiPayload
+{
+    template < typename... ArgTypes >
+    static int64 Bytes( ArgTypes... )
+    {
+        return 0;
+    }
+};
+
+#define HOUDINI_API_PAYLOAD( Name, Params, Expression ) \
+    template <> \
+    struct THoudiniApiPayload< HoudiniApiEntry_##Name > \
+    { \
+        static int64 Bytes Params \
+        { \
+            return Expression; \
+        } \
+    };
+
+/** Number of values of an attribute range, attribute info is only valid if the call succeeded. **/
+static int64
+HoudiniApiAttributeValueCount( const HAPI_AttributeInfo * AttributeInfo, int Length )
+{
+    return (int64) Length * ( AttributeInfo ? FMath::Max( AttributeInfo->tupleSize, 1 ) : 1 );
+}
+
+static int64
+HoudiniApiStringArrayBytes( const HAPI_AttributeInfo * AttributeInfo, const char ** Strings, int Length )
+{
+    int64 Bytes = 0;
+    const int64 StringCount = HoudiniApiAttributeValueCount( AttributeInfo, Length );
+    for ( int64 Idx = 0; Strings && Idx < StringCount; ++Idx )
+        Bytes += Strings[ Idx ] ? FCStringAnsi::Strlen( Strings[ Idx ] ) + 1 : 1;
+
+    return Bytes;
+}
+
+HOUDINI_API_PAYLOAD( GetString,
+    ( const HAPI_Session *, HAPI_StringHandle, char *, int length ),
+    length )
+HOUDINI_API_PAYLOAD( GetAttributeFloatData,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, HAPI_AttributeInfo * attr_info, int, float *, int, int length ),
+    HoudiniApiAttributeValueCount( attr_info, length ) * sizeof( float ) )
+HOUDINI_API_PAYLOAD( GetAttributeIntData,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, HAPI_AttributeInfo * attr_info, int, int *, int, int length ),
+    HoudiniApiAttributeValueCount( attr_info, length ) * sizeof( int ) )
+HOUDINI_API_PAYLOAD( GetAttributeStringData,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, HAPI_AttributeInfo * attr_info, HAPI_StringHandle *, int, int length ),
+    HoudiniApiAttributeValueCount( attr_info, length ) * sizeof( HAPI_StringHandle ) )
+HOUDINI_API_PAYLOAD( SetAttributeFloatData,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, const HAPI_AttributeInfo * attr_info, const float *, int, int length ),
+    HoudiniApiAttributeValueCount( attr_info, length ) * sizeof( float ) )
+HOUDINI_API_PAYLOAD( SetAttributeIntData,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, const HAPI_AttributeInfo * attr_info, const int *, int, int length ),
+    HoudiniApiAttributeValueCount( attr_info, length ) * sizeof( int ) )
+HOUDINI_API_PAYLOAD( SetAttributeStringData,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, const HAPI_AttributeInfo * attr_info, const char ** data_array, int, int length ),
+    HoudiniApiStringArrayBytes( attr_info, data_array, length ) )
+HOUDINI_API_PAYLOAD( GetVertexList,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, int *, int, int length ),
+    (int64) length * sizeof( int ) )
+HOUDINI_API_PAYLOAD( SetVertexList,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const int *, int, int length ),
+    (int64) length * sizeof( int ) )
+HOUDINI_API_PAYLOAD( GetFaceCounts,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, int *, int, int length ),
+    (int64) length * sizeof( int ) )
+HOUDINI_API_PAYLOAD( SetFaceCounts,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const int *, int, int length ),
+    (int64) length * sizeof( int ) )
+HOUDINI_API_PAYLOAD( GetMaterialNodeIdsOnFaces,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, HAPI_Bool *, HAPI_NodeId *, int, int length ),
+    (int64) length * sizeof( HAPI_NodeId ) )
+HOUDINI_API_PAYLOAD( GetGroupMembership,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, HAPI_GroupType, const char *, HAPI_Bool *, int *, int, int length ),
+    (int64) length * sizeof( int ) )
+HOUDINI_API_PAYLOAD( SetGroupMembership,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, HAPI_GroupType, const char *, const int *, int, int length ),
+    (int64) length * sizeof( int ) )
+HOUDINI_API_PAYLOAD( GetInstancerPartTransforms,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, HAPI_RSTOrder, HAPI_Transform *, int, int length ),
+    (int64) length * sizeof( HAPI_Transform ) )
+HOUDINI_API_PAYLOAD( GetComposedObjectList,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_ObjectInfo *, int, int length ),
+    (int64) length * sizeof( HAPI_ObjectInfo ) )
+HOUDINI_API_PAYLOAD( GetComposedObjectTransforms,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_RSTOrder, HAPI_Transform *, int, int length ),
+    (int64) length * sizeof( HAPI_Transform ) )
+HOUDINI_API_PAYLOAD( GetComposedChildNodeList,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_NodeId *, int count ),
+    (int64) count * sizeof( HAPI_NodeId ) )
+HOUDINI_API_PAYLOAD( GetParameters,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_ParmInfo *, int, int length ),
+    (int64) length * sizeof( HAPI_ParmInfo ) )
+HOUDINI_API_PAYLOAD( GetParmFloatValues,
+    ( const HAPI_Session *, HAPI_NodeId, float *, int, int length ),
+    (int64) length * sizeof( float ) )
+HOUDINI_API_PAYLOAD( GetParmIntValues,
+    ( const HAPI_Session *, HAPI_NodeId, int *, int, int length ),
+    (int64) length * sizeof( int ) )
+HOUDINI_API_PAYLOAD( GetParmStringValues,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_Bool, HAPI_StringHandle *, int, int length ),
+    (int64) length * sizeof( HAPI_StringHandle ) )
+HOUDINI_API_PAYLOAD( SetParmFloatValues,
+    ( const HAPI_Session *, HAPI_NodeId, const float *, int, int length ),
+    (int64) length * sizeof( float ) )
+HOUDINI_API_PAYLOAD( SetParmIntValues,
+    ( const HAPI_Session *, HAPI_NodeId, const int *, int, int length ),
+    (int64) length * sizeof( int ) )
+HOUDINI_API_PAYLOAD( SetCurveCounts,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const int *, int, int length ),
+    (int64) length * sizeof( int ) )
+HOUDINI_API_PAYLOAD( SetCurveOrders,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const int *, int, int length ),
+    (int64) length * sizeof( int ) )
+HOUDINI_API_PAYLOAD( SetCurveKnots,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const float *, int, int length ),
+    (int64) length * sizeof( float ) )
+HOUDINI_API_PAYLOAD( GetHeightFieldData,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, float *, int, int length ),
+    (int64) length * sizeof( float ) )
+HOUDINI_API_PAYLOAD( SetHeightFieldData,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const char *, const float *, int, int length ),
+    (int64) length * sizeof( float ) )
+HOUDINI_API_PAYLOAD( GetVolumeTileFloatData,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, float, const HAPI_VolumeTileInfo *, float *, int length ),
+    (int64) length * sizeof( float ) )
+HOUDINI_API_PAYLOAD( SetVolumeTileFloatData,
+    ( const HAPI_Session *, HAPI_NodeId, HAPI_PartId, const HAPI_VolumeTileInfo *, const float *, int length ),
+    (int64) length * sizeof( float ) )
+HOUDINI_API_PAYLOAD( GetImageMemoryBuffer,
+    ( const HAPI_Session *, HAPI_NodeId, char *, int length ),
+    length )
+HOUDINI_API_PAYLOAD( LoadAssetLibraryFromMemory,
+    ( const HAPI_Session *, const char *, int library_buffer_length, HAPI_Bool, HAPI_AssetLibraryId * ),
+    library_buffer_length )
+HOUDINI_API_PAYLOAD( SaveGeoToMemory,
+    ( const HAPI_Session *, HAPI_NodeId, char *, int length ),
+    length )
+HOUDINI_API_PAYLOAD( LoadGeoFromMemory,
+    ( const HAPI_Session *, HAPI_NodeId, const char *, const char *, int length ),
+    length )
+
+#undef HOUDINI_API_PAYLOAD
+
+/** Probe replacing one entry point of the function table. **/
+template < int32 EntryIndex, typename FuncPtrType >
+struct THoudiniApiProbe;
+
+template < int32 EntryIndex, typename... ArgTypes >
+struct THoudiniApiProbe< EntryIndex, HAPI_Result (*)( ArgTypes... ) >
+{
+    typedef HAPI_Result (*FuncPtrType)( ArgTypes... );
+
+    static HAPI_Result Call( ArgTypes... Args )
+    {
+        SCOPE_CYCLE_COUNTER( STAT_HapiCalls );
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        const HAPI_Result Result = Original( Args... );
+        const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+
+        FHoudiniEngineApiProfiler::RecordCall(
+            EntryIndex, Cycles, THoudiniApiPayload< EntryIndex >::Bytes( Args... ), Result );
+
+        return Result;
+    }
+
+    /** Entry point which was bound when the probe was installed. **/
+    static FuncPtrType Original;
+};
+
+template < int32 EntryIndex, typename... ArgTypes >
+typename THoudiniApiProbe< EntryIndex, HAPI_Result (*)( ArgTypes... ) >::FuncPtrType
+THoudiniApiProbe< EntryIndex, HAPI_Result (*)( ArgTypes... ) >::Original = nullptr;
+
+#define HOUDINI_API_PROBE( Name ) THoudiniApiProbe< HoudiniApiEntry_##Name, FHoudiniApi::Name##FuncPtr >
+
+/** Return the bucket of the call duration histogram for the given number of cycles. **/
+static int32
+HoudiniApiHistogramBucket( uint64 Cycles )
+{
+    return Cycles > 0 ? FMath::Min( (int32) FMath::FloorLog2_64( Cycles ), 63 ) : 0;
+}
+
+static double
+HoudiniApiCyclesToMicroseconds( double Cycles )
+{
+    return Cycles * FPlatformTime::GetSecondsPerCycle64() * 1000000.0;
+}
+
+FHoudiniApiCallStats::FHoudiniApiCallStats()
+    : CallCount( 0 )
+    , FailedCallCount( 0 )
+    , TotalCycles( 0 )
+    , MaxCycles( 0 )
+    , TotalBytes( 0 )
+{
+    FMemory::Memzero( Histogram, sizeof( Histogram ) );
+}
+
+void
+FHoudiniApiCallStats::AddCall( uint64 Cycles, int64 Bytes, bool bFailed )
+{
+    CallCount++;
+    FailedCallCount += bFailed ? 1 : 0;
+    TotalCycles += Cycles;
+    MaxCycles = FMath::Max( MaxCycles, Cycles );
+    TotalBytes += Bytes;
+    Histogram[ HoudiniApiHistogramBucket( Cycles ) ]++;
+}
+
+void
+FHoudiniApiCallStats::Append( const FHoudiniApiCallStats & Other )
+{
+    CallCount += Other.CallCount;
+    FailedCallCount += Other.FailedCallCount;
+    TotalCycles += Other.TotalCycles;
+    MaxCycles = FMath::Max( MaxCycles, Other.MaxCycles );
+    TotalBytes += Other.TotalBytes;
+
+    for ( int32 Bucket = 0; Bucket < ARRAY_COUNT( Histogram ); ++Bucket )
+        Histogram[ Bucket ] += Other.Histogram[ Bucket ];
+}
+
+double
+FHoudiniApiCallStats::GetPercentileMicroseconds( float Fraction ) const
+{
+    if ( CallCount <= 0 )
+        return 0.0;
+
+    const double Rank = FMath::Clamp( Fraction, 0.0f, 1.0f ) * CallCount;
+    double CumulativeCount = 0.0;
+
+    for ( int32 Bucket = 0; Bucket < ARRAY_COUNT( Histogram ); ++Bucket )
+    {
+        if ( Histogram[ Bucket ] == 0 )
+            continue;
+
+        if ( CumulativeCount + Histogram[ Bucket ] >= Rank )
+        {
+            // Interpolate linearly within the bucket, clamped to the longest call.
+            const double BucketStart = Bucket > 0 ? FMath::Pow( 2.0f, Bucket ) : 0.0;
+            const double BucketEnd = FMath::Min( FMath::Pow( 2.0f, Bucket + 1 ), (float) MaxCycles );
+            const double Alpha = ( Rank - CumulativeCount ) / Histogram[ Bucket ];
+            return HoudiniApiCyclesToMicroseconds( FMath::Lerp( BucketStart, FMath::Max( BucketStart, BucketEnd ), Alpha ) );
+        }
+
+        CumulativeCount += Histogram[ Bucket ];
+    }
+
+    return GetMaxMicroseconds();
+}
+
+double
+FHoudiniApiCallStats::GetTotalMilliseconds() const
+{
+    return HoudiniApiCyclesToMicroseconds( (double) TotalCycles ) / 1000.0;
+}
+
+double
+FHoudiniApiCallStats::GetAverageMicroseconds() const
+{
+    return CallCount > 0 ? HoudiniApiCyclesToMicroseconds( (double) TotalCycles / CallCount ) : 0.0;
+}
+
+double
+FHoudiniApiCallStats::GetMaxMicroseconds() const
+{
+    return HoudiniApiCyclesToMicroseconds( (double) MaxCycles );
+}
+
+FCriticalSection
+FHoudiniEngineApiProfiler::CriticalSection;
+
+TMap< FString, TArray< FHoudiniApiCallStats > >
+FHoudiniEngineApiProfiler::ContextStats;
+
+bool
+FHoudiniEngineApiProfiler::bEnabled = false;
+
+uint32
+FHoudiniEngineApiProfiler::ContextTlsSlot = FHoudiniEngineApiProfiler::InvalidTlsSlot;
+
+bool
+FHoudiniEngineApiProfiler::IsRequested()
+{
+    return FParse::Param( FCommandLine::Get(), TEXT( "HoudiniApiProfile" ) );
+}
+
+bool
+FHoudiniEngineApiProfiler::Enable()
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    if ( bEnabled )
+        return true;
+
+    if ( !FHoudiniApi::IsHAPIInitialized() )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "Unable to profile Houdini Engine API calls, HAPI is not initialized." ) );
+        return false;
+    }
+
+    // Slot holding the profiling context of each thread, must exist before the probes can be hit.
+    ContextTlsSlot = FPlatformTLS::AllocTlsSlot();
+    if ( ContextTlsSlot == InvalidTlsSlot )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "Unable to profile Houdini Engine API calls, failed to allocate TLS slot." ) );
+        return false;
+    }
+
+#define HOUDINI_API_INSTALL_PROBE( Name ) \
+    HOUDINI_API_PROBE( Name )::Original = FHoudiniApi::Name; \
+    FHoudiniApi::Name = &HOUDINI_API_PROBE( Name )::Call;
+
+    HOUDINI_API_PROFILED_ENTRIES( HOUDINI_API_INSTALL_PROBE )
+
+#undef HOUDINI_API_INSTALL_PROBE
+
+    bEnabled = true;
+    HOUDINI_LOG_MESSAGE( TEXT( "Started profiling Houdini Engine API calls." ) );
+
+    return true;
+}
+
+void
+FHoudiniEngineApiProfiler::Disable()
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    if ( !bEnabled )
+        return;
+
+    // Only restore entry points which still point to our probes, the table may have been rebound since.
+#define HOUDINI_API_REMOVE_PROBE( Name ) \
+    if ( FHoudiniApi::Name == &HOUDINI_API_PROBE( Name )::Call ) \
+        FHoudiniApi::Name = HOUDINI_API_PROBE( Name )::Original;
+
+    HOUDINI_API_PROFILED_ENTRIES( HOUDINI_API_REMOVE_PROBE )
+
+#undef HOUDINI_API_REMOVE_PROBE
+
+    FPlatformTLS::FreeTlsSlot( ContextTlsSlot );
+    ContextTlsSlot = InvalidTlsSlot;
+
+    bEnabled = false;
+    HOUDINI_LOG_MESSAGE( TEXT( "Stopped profiling Houdini Engine API calls." ) );
+}
+
+bool
+FHoudiniEngineApiProfiler::IsEnabled()
+{
+    FScopeLock ScopeLock( &CriticalSection );
+    return bEnabled;
+}
+
+bool
+FHoudiniEngineApiProfiler::GetContextTlsSlot( uint32 & TlsSlot )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+    TlsSlot = ContextTlsSlot;
+    return bEnabled;
+}
+
+void
+FHoudiniEngineApiProfiler::Reset()
+{
+    FScopeLock ScopeLock( &CriticalSection );
+    ContextStats.Empty();
+}
+
+void
+FHoudiniEngineApiProfiler::RecordCall( int32 EntryIndex, uint64 Cycles, int64 Bytes, HAPI_Result Result )
+{
+    const bool bFailed = Result != HAPI_RESULT_SUCCESS;
+
+    INC_DWORD_STAT( STAT_HapiCallCount );
+    INC_DWORD_STAT_BY( STAT_HapiBytes, (uint32) Bytes );
+    if ( bFailed )
+        INC_DWORD_STAT( STAT_HapiFailedCallCount );
+
+    const FString & Context = FHoudiniEngineApiProfilerScope::GetCurrentContext();
+
+    FScopeLock ScopeLock( &CriticalSection );
+
+    TArray< FHoudiniApiCallStats > * EntryStats = ContextStats.Find( Context );
+    if ( !EntryStats )
+    {
+        EntryStats = &ContextStats.Add( Context );
+        EntryStats->SetNum( HoudiniApiEntry_Count );
+    }
+
+    ( *EntryStats )[ EntryIndex ].AddCall( Cycles, Bytes, bFailed );
+}
+
+/** Row of a profiling report. **/
+struct FHoudiniApiReportRow
+{
+    FString Context;
+    int32 EntryIndex;
+    FHoudiniApiCallStats Stats;
+};
+
+/** Collect recorded statistics, sorted by decreasing total time. Must be called with the lock held. **/
+static void
+HoudiniApiCollectReportRows(
+    const TMap< FString, TArray< FHoudiniApiCallStats > > & ContextStats, bool bMergeContexts,
+    TArray< FHoudiniApiReportRow > & Rows )
+{
+    Rows.Empty();
+
+    TMap< FString, int32 > RowIndices;
+    for ( const auto & ContextPair : ContextStats )
+    {
+        for ( int32 EntryIndex = 0; EntryIndex < ContextPair.Value.Num(); ++EntryIndex )
+        {
+            const FHoudiniApiCallStats & Stats = ContextPair.Value[ EntryIndex ];
+            if ( Stats.CallCount == 0 )
+                continue;
+
+            const FString Context = bMergeContexts ? FString( TEXT( "" ) ) : ContextPair.Key;
+            const FString RowKey = FString::Printf( TEXT( "%s|%d" ), *Context, EntryIndex );
+
+            int32 & RowIndex = RowIndices.FindOrAdd( RowKey );
+            if ( RowIndex == 0 )
+            {
+                FHoudiniApiReportRow Row;
+                Row.Context = Context;
+                Row.EntryIndex = EntryIndex;
+                RowIndex = Rows.Add( Row ) + 1;
+            }
+
+            Rows[ RowIndex - 1 ].Stats.Append( Stats );
+        }
+    }
+
+    Rows.Sort( []( const FHoudiniApiReportRow & A, const FHoudiniApiReportRow & B )
+    {
+        return A.Stats.TotalCycles > B.Stats.TotalCycles;
+    } );
+}
+
+void
+FHoudiniEngineApiProfiler::Dump( int32 MaxRows )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    TArray< FHoudiniApiReportRow > Rows;
+    HoudiniApiCollectReportRows( ContextStats, true, Rows );
+
+    FHoudiniApiCallStats Total;
+    for ( const FHoudiniApiReportRow & Row : Rows )
+        Total.Append( Row.Stats );
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Houdini Engine API profile: %lld calls (%lld failed), %.2f ms, %.2f MB transferred." ),
+        Total.CallCount, Total.FailedCallCount, Total.GetTotalMilliseconds(), Total.TotalBytes / ( 1024.0 * 1024.0 ) );
+
+    // Cost per context, which tells which components and phases drive the calls.
+    TArray< TPair< FString, FHoudiniApiCallStats > > Contexts;
+    for ( const auto & ContextPair : ContextStats )
+    {
+        FHoudiniApiCallStats ContextTotal;
+        for ( const FHoudiniApiCallStats & Stats : ContextPair.Value )
+            ContextTotal.Append( Stats );
+
+        Contexts.Add( TPair< FString, FHoudiniApiCallStats >( ContextPair.Key, ContextTotal ) );
+    }
+
+    Contexts.Sort( []( const TPair< FString, FHoudiniApiCallStats > & A, const TPair< FString, FHoudiniApiCallStats > & B )
+    {
+        return A.Value.TotalCycles > B.Value.TotalCycles;
+    } );
+
+    for ( int32 Idx = 0; Idx < Contexts.Num() && Idx < MaxRows; ++Idx )
+    {
+        const FHoudiniApiCallStats & Stats = Contexts[ Idx ].Value;
+        HOUDINI_LOG_MESSAGE(
+            TEXT( "    %-48s %10lld calls %10.2f ms %10.2f MB" ),
+            Contexts[ Idx ].Key.IsEmpty() ? TEXT( "<unattributed>" ) : *Contexts[ Idx ].Key,
+            Stats.CallCount, Stats.GetTotalMilliseconds(), Stats.TotalBytes / ( 1024.0 * 1024.0 ) );
+    }
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "    %-36s %10s %6s %10s %9s %9s %9s %9s %10s" ),
+        TEXT( "Entry point" ), TEXT( "Calls" ), TEXT( "Failed" ), TEXT( "Total ms" ),
+        TEXT( "Avg us" ), TEXT( "P50 us" ), TEXT( "P99 us" ), TEXT( "Max us" ), TEXT( "KB" ) );
+
+    for ( int32 Idx = 0; Idx < Rows.Num() && Idx < MaxRows; ++Idx )
+    {
+        const FHoudiniApiCallStats & Stats = Rows[ Idx ].Stats;
+        HOUDINI_LOG_MESSAGE(
+            TEXT( "    %-36s %10lld %6lld %10.2f %9.1f %9.1f %9.1f %9.1f %10.1f" ),
+            HoudiniApiEntryNames[ Rows[ Idx ].EntryIndex ], Stats.CallCount, Stats.FailedCallCount,
+            Stats.GetTotalMilliseconds(), Stats.GetAverageMicroseconds(), Stats.GetPercentileMicroseconds( 0.5f ),
+            Stats.GetPercentileMicroseconds( 0.99f ), Stats.GetMaxMicroseconds(), Stats.TotalBytes / 1024.0 );
+    }
+}
+
+bool
+FHoudiniEngineApiProfiler::ExportCsv( const FString & FilePath, FString & WrittenFilePath )
+{
+    WrittenFilePath = FilePath;
+    if ( WrittenFilePath.IsEmpty() )
+    {
+        WrittenFilePath = FPaths::ProfilingDir() / TEXT( "HoudiniEngine" ) /
+            FString::Printf( TEXT( "HapiCalls-%s.csv" ), *FDateTime::Now().ToString() );
+    }
+
+    FString Csv = TEXT( "Context,EntryPoint,Calls,FailedCalls,TotalMs,AverageUs,P50Us,P90Us,P99Us,MaxUs,Bytes\n" );
+
+    {
+        FScopeLock ScopeLock( &CriticalSection );
+
+        TArray< FHoudiniApiReportRow > Rows;
+        HoudiniApiCollectReportRows( ContextStats, false, Rows );
+
+        for ( const FHoudiniApiReportRow & Row : Rows )
+        {
+            const FHoudiniApiCallStats & Stats = Row.Stats;
+            Csv += FString::Printf(
+                TEXT( "\"%s\",%s,%lld,%lld,%.4f,%.3f,%.3f,%.3f,%.3f,%.3f,%lld\n" ),
+                *Row.Context.Replace( TEXT( "\"" ), TEXT( "\"\"" ) ), HoudiniApiEntryNames[ Row.EntryIndex ],
+                Stats.CallCount, Stats.FailedCallCount, Stats.GetTotalMilliseconds(), Stats.GetAverageMicroseconds(),
+                Stats.GetPercentileMicroseconds( 0.5f ), Stats.GetPercentileMicroseconds( 0.9f ),
+                Stats.GetPercentileMicroseconds( 0.99f ), Stats.GetMaxMicroseconds(), Stats.TotalBytes );
+        }
+    }
+
+    if ( !FFileHelper::SaveStringToFile( Csv, *WrittenFilePath ) )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Failed writing Houdini Engine API profile to %s." ), *WrittenFilePath );
+        return false;
+    }
+
+    HOUDINI_LOG_MESSAGE( TEXT( "Wrote Houdini Engine API profile to %s." ), *WrittenFilePath );
+    return true;
+}
+
+void
+FHoudiniEngineApiProfiler::RegisterConsoleCommands()
+{
+    static FAutoConsoleCommand CCmdApiProfileStart = FAutoConsoleCommand(
+        TEXT( "Houdini.ApiProfile.Start" ),
+        TEXT( "Start recording Houdini Engine API call counts, latency and transferred bytes." ),
+        FConsoleCommandDelegate::CreateLambda( []() { FHoudiniEngineApiProfiler::Enable(); } ) );
+
+    static FAutoConsoleCommand CCmdApiProfileStop = FAutoConsoleCommand(
+        TEXT( "Houdini.ApiProfile.Stop" ),
+        TEXT( "Stop recording Houdini Engine API calls, recorded statistics are kept." ),
+        FConsoleCommandDelegate::CreateStatic( &FHoudiniEngineApiProfiler::Disable ) );
+
+    static FAutoConsoleCommand CCmdApiProfileReset = FAutoConsoleCommand(
+        TEXT( "Houdini.ApiProfile.Reset" ),
+        TEXT( "Discard recorded Houdini Engine API statistics." ),
+        FConsoleCommandDelegate::CreateStatic( &FHoudiniEngineApiProfiler::Reset ) );
+
+    static FAutoConsoleCommand CCmdApiProfileDump = FAutoConsoleCommand(
+        TEXT( "Houdini.ApiProfile.Dump" ),
+        TEXT( "Log the most expensive Houdini Engine API entry points. Optional argument is the number of rows." ),
+        FConsoleCommandWithArgsDelegate::CreateLambda( []( const TArray< FString > & Args )
+        {
+            FHoudiniEngineApiProfiler::Dump( Args.Num() > 0 ? FMath::Max( FCString::Atoi( *Args[ 0 ] ), 1 ) : 25 );
+        } ) );
+
+    static FAutoConsoleCommand CCmdApiProfileCsv = FAutoConsoleCommand(
+        TEXT( "Houdini.ApiProfile.Csv" ),
+        TEXT( "Write recorded Houdini Engine API statistics to a CSV file. Optional argument is the file path." ),
+        FConsoleCommandWithArgsDelegate::CreateLambda( []( const TArray< FString > & Args )
+        {
+            FString WrittenFilePath;
+            FHoudiniEngineApiProfiler::ExportCsv( Args.Num() > 0 ? Args[ 0 ] : FString(), WrittenFilePath );
+        } ) );
+}
+
+FHoudiniEngineApiProfilerScope::FHoudiniEngineApiProfilerScope( const FString & ComponentName, const TCHAR * Phase )
+    : PreviousContext( nullptr )
+    , ContextTlsSlot( FHoudiniEngineApiProfiler::InvalidTlsSlot )
+    , bActive( false )
+{
+    if ( !FHoudiniEngineApiProfiler::GetContextTlsSlot( ContextTlsSlot ) )
+        return;
+
+    Context = FString::Printf( TEXT( "%s:%s" ), *ComponentName, Phase );
+    PreviousContext = (const FString *) FPlatformTLS::GetTlsValue( ContextTlsSlot );
+    FPlatformTLS::SetTlsValue( ContextTlsSlot, (void *) &Context );
+    bActive = true;
+}
+
+FHoudiniEngineApiProfilerScope::~FHoudiniEngineApiProfilerScope()
+{
+    if ( !bActive )
+        return;
+
+    // Profiling may have been restarted while in scope, in which case our slot is gone.
+    uint32 TlsSlot = FHoudiniEngineApiProfiler::InvalidTlsSlot;
+    if ( FHoudiniEngineApiProfiler::GetContextTlsSlot( TlsSlot ) && TlsSlot == ContextTlsSlot )
+        FPlatformTLS::SetTlsValue( ContextTlsSlot, (void *) PreviousContext );
+}
+
+const FString &
+FHoudiniEngineApiProfilerScope::GetCurrentContext()
+{
+    static const FString UnattributedContext = TEXT( "" );
+
+    uint32 TlsSlot = FHoudiniEngineApiProfiler::InvalidTlsSlot;
+    if ( !FHoudiniEngineApiProfiler::GetContextTlsSlot( TlsSlot ) )
+        return UnattributedContext;
+
+    const FString * CurrentContext = (const FString *) FPlatformTLS::GetTlsValue( TlsSlot );
+    return CurrentContext ? *CurrentContext : UnattributedContext;
+}
+
+#undef HOUDINI_API_PROBE
@@ -0,0 +1,145 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "HAPI_Common.h"
+
+/** Statistics of calls made to one Houdini Engine API entry point. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniApiCallStats
+{
+    FHoudiniApiCallStats();
+
+    /** Record a call which took the given number of cycles and transferred the given number of bytes. **/
+    void AddCall( uint64 Cycles, int64 Bytes, bool bFailed );
+
+    /** Accumulate statistics of another context. **/
+    void Append( const FHoudiniApiCallStats & Other );
+
+    /** Estimate the duration, in microseconds, under which the given fraction of calls completed. **/
+    double GetPercentileMicroseconds( float Fraction ) const;
+
+    /** Return total and average duration. **/
+    double GetTotalMilliseconds() const;
+    double GetAverageMicroseconds() const;
+    double GetMaxMicroseconds() const;
+
+    /** Number of calls and number of calls which did not return HAPI_RESULT_SUCCESS. **/
+    int64 CallCount;
+    int64 FailedCallCount;
+
+    /** Cumulative and longest call duration, in cycles. **/
+    uint64 TotalCycles;
+    uint64 MaxCycles;
+
+    /** Bytes copied in or out by the calls, only counted for array entry points. **/
+    int64 TotalBytes;
+
+    /** Number of calls per power of two duration bucket, in cycles. **/
+    uint32 Histogram[ 64 ];
+};
+
+/** Optional instrumentation of the FHoudiniApi function table. When enabled, every entry point is routed **/
+/** through a probe recording call counts, latency and transferred bytes, attributed to the profiling scope **/
+/** active on the calling thread. Results are exposed through the HoudiniEngine stat group, the **/
+/** Houdini.ApiProfile console commands and CSV export. **/
+class HOUDINIENGINERUNTIME_API FHoudiniEngineApiProfiler
+{
+    public:
+
+        /** Return true if profiling was requested on the command line with -HoudiniApiProfile. **/
+        static bool IsRequested();
+
+        /** Install the probes. HAPI must be initialized, FHoudiniApi::FinalizeHAPI drops the probes. **/
+        static bool Enable();
+
+        /** Restore the original entry points, recorded statistics are kept. **/
+        static void Disable();
+
+        /** Return true if the probes are installed. **/
+        static bool IsEnabled();
+
+        /** Discard all recorded statistics. **/
+        static void Reset();
+
+        /** Log the most expensive entry points, per context and in total. **/
+        static void Dump( int32 MaxRows = 25 );
+
+        /** Write all recorded statistics to a CSV file, an empty path writes to the profiling directory. **/
+        static bool ExportCsv( const FString & FilePath, FString & WrittenFilePath );
+
+        /** Register Houdini.ApiProfile.* console commands. **/
+        static void RegisterConsoleCommands();
+
+    public:
+
+        /** Record a completed call, used by the probes. **/
+        static void RecordCall( int32 EntryIndex, uint64 Cycles, int64 Bytes, HAPI_Result Result );
+
+        /** Retrieve TLS slot holding the profiling context of each thread, return false if disabled. **/
+        static bool GetContextTlsSlot( uint32 & TlsSlot );
+
+        /** Value of an unallocated TLS slot. **/
+        static const uint32 InvalidTlsSlot = 0xFFFFFFFF;
+
+    protected:
+
+        /** Synchronization primitive. **/
+        static FCriticalSection CriticalSection;
+
+        /** Recorded statistics per context, indexed by entry point. **/
+        static TMap< FString, TArray< FHoudiniApiCallStats > > ContextStats;
+
+        /** Set while the probes are installed. **/
+        static bool bEnabled;
+
+        /** TLS slot holding the profiling context of each thread, allocated while enabled. **/
+        static uint32 ContextTlsSlot;
+};
+
+/** Attribute HAPI calls made by this thread to a component and phase (instantiation, cook, translation, **/
+/** upload) while in scope. Scopes nest, the innermost one wins. Does nothing while profiling is disabled. **/
+class HOUDINIENGINERUNTIME_API FHoudiniEngineApiProfilerScope
+{
+    public:
+
+        FHoudiniEngineApiProfilerScope( const FString & ComponentName, const TCHAR * Phase );
+        ~FHoudiniEngineApiProfilerScope();
+
+        /** Return context of the calling thread. **/
+        static const FString & GetCurrentContext();
+
+    private:
+
+        /** Context of this scope. **/
+        FString Context;
+
+        /** Context which was active when this scope was entered. **/
+        const FString * PreviousContext;
+
+        /** TLS slot this scope stored its context in. **/
+        uint32 ContextTlsSlot;
+
+        /** Set if this scope changed the calling thread's context. **/
+        bool bActive;
+};
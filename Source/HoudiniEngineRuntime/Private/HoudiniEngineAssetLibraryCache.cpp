@@ -0,0 +1,78 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineAssetLibraryCache.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+FCriticalSection
+FHoudiniEngineAssetLibraryCache::CriticalSection;
+
+TMap< FString, FHoudiniEngineAssetLibraryCache::FLoadedLibrary >
+FHoudiniEngineAssetLibraryCache::Libraries;
+
+HAPI_AssetLibraryId
+FHoudiniEngineAssetLibraryCache::FindLibrary(
+    const FString & LibraryPath, const FDateTime & TimeStamp, uint32 ContentHash, int32 & OutAssetCount )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    OutAssetCount = 0;
+
+    const FLoadedLibrary * LoadedLibrary = Libraries.Find( LibraryPath );
+    if ( !LoadedLibrary || LoadedLibrary->TimeStamp != TimeStamp || LoadedLibrary->ContentHash != ContentHash )
+        return -1;
+
+    OutAssetCount = LoadedLibrary->AssetCount;
+    return LoadedLibrary->LibraryId;
+}
+
+void
+FHoudiniEngineAssetLibraryCache::AddLibrary(
+    const FString & LibraryPath, const FDateTime & TimeStamp, uint32 ContentHash,
+    HAPI_AssetLibraryId LibraryId, int32 AssetCount )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    FLoadedLibrary & LoadedLibrary = Libraries.FindOrAdd( LibraryPath );
+    LoadedLibrary.TimeStamp = TimeStamp;
+    LoadedLibrary.ContentHash = ContentHash;
+    LoadedLibrary.LibraryId = LibraryId;
+    LoadedLibrary.AssetCount = AssetCount;
+}
+
+void
+FHoudiniEngineAssetLibraryCache::RemoveLibrary( const FString & LibraryPath )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    Libraries.Remove( LibraryPath );
+}
+
+void
+FHoudiniEngineAssetLibraryCache::Reset()
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    Libraries.Empty();
+}
@@ -0,0 +1,75 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "HAPI_Common.h"
+
+/** Session wide registry of loaded asset libraries. A library is keyed by its resolved path and validated **/
+/** against the modification time of the file, libraries loaded from memory are keyed and validated on a hash **/
+/** of the asset bytes. Instantiating many copies of the same HDA only loads its library once. **/
+class HOUDINIENGINERUNTIME_API FHoudiniEngineAssetLibraryCache
+{
+    public:
+
+        /** Return the library loaded for the given path, or -1 if it was not loaded or its source changed since. **/
+        static HAPI_AssetLibraryId FindLibrary(
+            const FString & LibraryPath, const FDateTime & TimeStamp, uint32 ContentHash, int32 & OutAssetCount );
+
+        /** Register a freshly loaded library, replacing any previous library loaded for the same path. **/
+        static void AddLibrary(
+            const FString & LibraryPath, const FDateTime & TimeStamp, uint32 ContentHash,
+            HAPI_AssetLibraryId LibraryId, int32 AssetCount );
+
+        /** Forget the library loaded for the given path. **/
+        static void RemoveLibrary( const FString & LibraryPath );
+
+        /** Forget all libraries, used when the session goes away. **/
+        static void Reset();
+
+    protected:
+
+        /** Loaded library and the state of its source when it was loaded. **/
+        struct FLoadedLibrary
+        {
+            FLoadedLibrary() : ContentHash( 0u ), LibraryId( -1 ), AssetCount( 0 ) {}
+
+            /** Modification time of the library file, or FDateTime::MinValue() if loaded from memory. **/
+            FDateTime TimeStamp;
+
+            /** Hash of the asset bytes if loaded from memory, 0 otherwise. **/
+            uint32 ContentHash;
+
+            /** Library id and number of assets it contains. **/
+            HAPI_AssetLibraryId LibraryId;
+            int32 AssetCount;
+        };
+
+    protected:
+
+        /** Synchronization primitive. **/
+        static FCriticalSection CriticalSection;
+
+        /** Loaded libraries, by path, or by content hash for libraries loaded from memory. **/
+        static TMap< FString, FLoadedLibrary > Libraries;
+};
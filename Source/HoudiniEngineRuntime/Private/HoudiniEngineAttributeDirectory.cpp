@@ -0,0 +1,155 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineAttributeDirectory.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineString.h"
+
+FCriticalSection
+FHoudiniEngineAttributeDirectory::CriticalSection;
+
+TMap< uint64, FHoudiniEngineAttributeDirectory::FPartAttributes >
+FHoudiniEngineAttributeDirectory::Parts;
+
+const FHoudiniEngineAttributeDirectory::FPartAttributes *
+FHoudiniEngineAttributeDirectory::FindOrBuild( HAPI_NodeId GeoId, HAPI_PartId PartId )
+{
+    const uint64 Key = ( (uint64) (uint32) GeoId << 32 ) | (uint64) (uint32) PartId;
+    if ( const FPartAttributes * FoundPart = Parts.Find( Key ) )
+        return FoundPart;
+
+    HAPI_PartInfo PartInfo;
+    FMemory::Memzero< HAPI_PartInfo >( PartInfo );
+    if ( FHoudiniApi::GetPartInfo(
+        FHoudiniEngine::Get().GetSession(), GeoId, PartId, &PartInfo ) != HAPI_RESULT_SUCCESS )
+    {
+        return nullptr;
+    }
+
+    FPartAttributes PartAttributes;
+    for ( int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx )
+    {
+        int32 AttributeCount = PartInfo.attributeCounts[ AttrIdx ];
+        if ( AttributeCount <= 0 )
+            continue;
+
+        TArray< HAPI_StringHandle > AttributeNameHandles;
+        AttributeNameHandles.SetNumUninitialized( AttributeCount );
+
+        if ( FHoudiniApi::GetAttributeNames(
+            FHoudiniEngine::Get().GetSession(), GeoId, PartId, (HAPI_AttributeOwner) AttrIdx,
+            &AttributeNameHandles[ 0 ], AttributeCount ) != HAPI_RESULT_SUCCESS )
+        {
+            return nullptr;
+        }
+
+        FHoudiniEngineStringCache::ResolveHandles( AttributeNameHandles, PartAttributes.Names[ AttrIdx ] );
+    }
+
+    return &Parts.Add( Key, PartAttributes );
+}
+
+HAPI_AttributeOwner
+FHoudiniEngineAttributeDirectory::FindOwner(
+    HAPI_NodeId GeoId, HAPI_PartId PartId, const char * Name, HAPI_AttributeOwner Owner )
+{
+    const FPartAttributes * PartAttributes = FindOrBuild( GeoId, PartId );
+    if ( !PartAttributes || !Name )
+        return HAPI_ATTROWNER_INVALID;
+
+    // Attribute names are case sensitive in Houdini.
+    FString AttributeName = UTF8_TO_TCHAR( Name );
+
+    int32 FirstOwner = ( Owner == HAPI_ATTROWNER_INVALID ) ? 0 : (int32) Owner;
+    int32 LastOwner = ( Owner == HAPI_ATTROWNER_INVALID ) ? HAPI_ATTROWNER_MAX - 1 : (int32) Owner;
+    for ( int32 AttrIdx = FirstOwner; AttrIdx <= LastOwner && AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx )
+    {
+        for ( const FString & ExistingName : PartAttributes->Names[ AttrIdx ] )
+        {
+            if ( ExistingName.Equals( AttributeName, ESearchCase::CaseSensitive ) )
+                return (HAPI_AttributeOwner) AttrIdx;
+        }
+    }
+
+    return HAPI_ATTROWNER_INVALID;
+}
+
+bool
+FHoudiniEngineAttributeDirectory::HasAttribute(
+    HAPI_NodeId GeoId, HAPI_PartId PartId, const char * Name, HAPI_AttributeOwner Owner )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    return FindOwner( GeoId, PartId, Name, Owner ) != HAPI_ATTROWNER_INVALID;
+}
+
+bool
+FHoudiniEngineAttributeDirectory::GetAttributeInfo(
+    HAPI_NodeId GeoId, HAPI_PartId PartId, const char * Name,
+    HAPI_AttributeOwner Owner, HAPI_AttributeInfo & AttributeInfo )
+{
+    FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
+
+    HAPI_AttributeOwner FoundOwner = HAPI_ATTROWNER_INVALID;
+    {
+        FScopeLock ScopeLock( &CriticalSection );
+        FoundOwner = FindOwner( GeoId, PartId, Name, Owner );
+    }
+
+    // The attribute does not exist, no need to ask HAPI.
+    if ( FoundOwner == HAPI_ATTROWNER_INVALID )
+        return true;
+
+    // Counts and storage can change between cooks, so the info itself is always fetched.
+    return FHoudiniApi::GetAttributeInfo(
+        FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name, FoundOwner, &AttributeInfo ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniEngineAttributeDirectory::GetAttributeNames(
+    HAPI_NodeId GeoId, HAPI_PartId PartId, HAPI_AttributeOwner Owner, TArray< FString > & AttributeNames )
+{
+    AttributeNames.Empty();
+
+    if ( Owner < 0 || Owner >= HAPI_ATTROWNER_MAX )
+        return false;
+
+    FScopeLock ScopeLock( &CriticalSection );
+
+    const FPartAttributes * PartAttributes = FindOrBuild( GeoId, PartId );
+    if ( !PartAttributes )
+        return false;
+
+    AttributeNames = PartAttributes->Names[ Owner ];
+    return true;
+}
+
+void
+FHoudiniEngineAttributeDirectory::Reset()
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    Parts.Empty();
+}
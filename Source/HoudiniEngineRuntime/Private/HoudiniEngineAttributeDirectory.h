@@ -0,0 +1,74 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "HAPI_Common.h"
+
+/** Names of the attributes of each part, per owner. A part's entry is built from GetAttributeNames the first
+    time one of its attributes is looked up, and stays valid until the next cook. **/
+class HOUDINIENGINERUNTIME_API FHoudiniEngineAttributeDirectory
+{
+    public:
+
+        /** Return true if the part has an attribute with this name. HAPI_ATTROWNER_INVALID searches all owners. **/
+        static bool HasAttribute(
+            HAPI_NodeId GeoId, HAPI_PartId PartId, const char * Name, HAPI_AttributeOwner Owner );
+
+        /** Fill AttributeInfo for the given attribute. With HAPI_ATTROWNER_INVALID, owners are searched in HAPI order.
+            Only the owner holding the attribute is queried, missing attributes do not touch the session.
+            Returns false on HAPI failure; AttributeInfo.exists tells whether the attribute was found. **/
+        static bool GetAttributeInfo(
+            HAPI_NodeId GeoId, HAPI_PartId PartId, const char * Name,
+            HAPI_AttributeOwner Owner, HAPI_AttributeInfo & AttributeInfo );
+
+        /** Return the names of all attributes of the given owner. **/
+        static bool GetAttributeNames(
+            HAPI_NodeId GeoId, HAPI_PartId PartId, HAPI_AttributeOwner Owner, TArray< FString > & AttributeNames );
+
+        /** Discard all directory entries. **/
+        static void Reset();
+
+    protected:
+
+        /** Attribute names of a single part, indexed by owner. **/
+        struct FPartAttributes
+        {
+            TArray< FString > Names[ HAPI_ATTROWNER_MAX ];
+        };
+
+        /** Return the entry for the given part, building it if needed. Must be called with the lock held. **/
+        static const FPartAttributes * FindOrBuild( HAPI_NodeId GeoId, HAPI_PartId PartId );
+
+        /** Return the owner of the named attribute, or HAPI_ATTROWNER_INVALID. Must be called with the lock held. **/
+        static HAPI_AttributeOwner FindOwner(
+            HAPI_NodeId GeoId, HAPI_PartId PartId, const char * Name, HAPI_AttributeOwner Owner );
+
+    protected:
+
+        /** Synchronization primitive. **/
+        static FCriticalSection CriticalSection;
+
+        /** Entries, keyed by geo and part id. **/
+        static TMap< uint64, FPartAttributes > Parts;
+};
@@ -0,0 +1,222 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineInputMeshCache.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineString.h"
+
+FHoudiniEngineInputMeshCacheKey::FHoudiniEngineInputMeshCacheKey()
+    : MeshPath( TEXT( "" ) )
+    , ContentHash( 0u )
+    , bExportAllLODs( false )
+    , bExportSockets( false )
+{}
+
+bool
+FHoudiniEngineInputMeshCacheKey::operator==( const FHoudiniEngineInputMeshCacheKey & Other ) const
+{
+    return ContentHash == Other.ContentHash && bExportAllLODs == Other.bExportAllLODs
+        && bExportSockets == Other.bExportSockets && MeshPath == Other.MeshPath;
+}
+
+uint32
+GetTypeHash( const FHoudiniEngineInputMeshCacheKey & Key )
+{
+    uint32 Hash = HashCombine( GetTypeHash( Key.MeshPath ), Key.ContentHash );
+    return HashCombine( Hash, ( Key.bExportAllLODs ? 1u : 0u ) | ( Key.bExportSockets ? 2u : 0u ) );
+}
+
+FCriticalSection
+FHoudiniEngineInputMeshCache::CriticalSection;
+
+TMap< FHoudiniEngineInputMeshCacheKey, FHoudiniEngineInputMeshCache::FSharedNode >
+FHoudiniEngineInputMeshCache::SharedNodes;
+
+TMap< HAPI_NodeId, FHoudiniEngineInputMeshCacheKey >
+FHoudiniEngineInputMeshCache::References;
+
+TMap< HAPI_NodeId, HAPI_NodeId >
+FHoudiniEngineInputMeshCache::ReferenceParents;
+
+HAPI_NodeId
+FHoudiniEngineInputMeshCache::FindSharedNode( const FHoudiniEngineInputMeshCacheKey & Key )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    const FSharedNode * SharedNode = SharedNodes.Find( Key );
+    if ( !SharedNode )
+        return -1;
+
+    // The node might have been deleted from within the session.
+    if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( SharedNode->NodeId ) )
+        return -1;
+
+    return SharedNode->NodeId;
+}
+
+bool
+FHoudiniEngineInputMeshCache::AddSharedNode(
+    const FHoudiniEngineInputMeshCacheKey & Key, HAPI_NodeId SharedNodeId, const TArray< HAPI_NodeId > & OwnedNodeIds )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    // Reference nodes locate the shared node by its absolute path.
+    HAPI_StringHandle PathHandle = -1;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetNodePath(
+        FHoudiniEngine::Get().GetSession(), SharedNodeId, -1, &PathHandle ), false );
+
+    FString NodePath = TEXT( "" );
+    if ( !FHoudiniEngineString( PathHandle ).ToFString( NodePath ) )
+        return false;
+
+    // A stale entry with the same key may remain if its node was deleted from within the session,
+    // its references keep counting against the new node.
+    FSharedNode & SharedNode = SharedNodes.FindOrAdd( Key );
+    SharedNode.NodeId = SharedNodeId;
+    SharedNode.NodePath = NodePath;
+    SharedNode.OwnedNodeIds = OwnedNodeIds;
+
+    return true;
+}
+
+bool
+FHoudiniEngineInputMeshCache::CreateReference(
+    const FHoudiniEngineInputMeshCacheKey & Key, HAPI_NodeId & ReferenceNodeId, TArray< HAPI_NodeId > & OutCreatedNodeIds )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    if ( !SharedNodes.Contains( Key ) )
+        return false;
+
+    // Existing references only need to be retargeted if the mesh has changed.
+    FHoudiniEngineInputMeshCacheKey PreviousKey;
+    bool bHasPreviousKey = false;
+    if ( const FHoudiniEngineInputMeshCacheKey * ReferencedKey = References.Find( ReferenceNodeId ) )
+    {
+        if ( *ReferencedKey == Key )
+            return true;
+
+        PreviousKey = *ReferencedKey;
+        bHasPreviousKey = true;
+    }
+    else
+    {
+        HAPI_NodeId NodeId = -1;
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+            FHoudiniEngine::Get().GetSession(), -1,
+            "SOP/object_merge", nullptr, true, &NodeId ), false );
+
+        HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId( NodeId );
+        OutCreatedNodeIds.AddUnique( ParentId );
+        ReferenceParents.Add( ParentId, NodeId );
+        ReferenceNodeId = NodeId;
+
+        // Reference nodes are transformed by their parent OBJ node, do not carry the shared node's transform over.
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmIntValue(
+            FHoudiniEngine::Get().GetSession(), NodeId, "xformtype", 0, 0 ), false );
+    }
+
+    FSharedNode & SharedNode = SharedNodes.FindChecked( Key );
+
+    HAPI_ParmId ParmId = -1;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmIdFromName(
+        FHoudiniEngine::Get().GetSession(), ReferenceNodeId, "objpath1", &ParmId ), false );
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmStringValue(
+        FHoudiniEngine::Get().GetSession(), ReferenceNodeId,
+        TCHAR_TO_UTF8( *SharedNode.NodePath ), ParmId, 0 ), false );
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
+        FHoudiniEngine::Get().GetSession(), ReferenceNodeId, nullptr ), false );
+
+    SharedNode.ReferenceCount++;
+    References.Add( ReferenceNodeId, Key );
+
+    if ( bHasPreviousKey )
+        RemoveReference( PreviousKey );
+
+    return true;
+}
+
+bool
+FHoudiniEngineInputMeshCache::IsReference( HAPI_NodeId NodeId )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+    return References.Contains( NodeId );
+}
+
+void
+FHoudiniEngineInputMeshCache::ReleaseReference( HAPI_NodeId NodeId )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    // Inputs destroy either the reference node or its parent OBJ node, or both.
+    HAPI_NodeId ReferenceNodeId = NodeId;
+    if ( const HAPI_NodeId * ChildNodeId = ReferenceParents.Find( NodeId ) )
+        ReferenceNodeId = *ChildNodeId;
+
+    FHoudiniEngineInputMeshCacheKey Key;
+    if ( !References.RemoveAndCopyValue( ReferenceNodeId, Key ) )
+        return;
+
+    for ( auto Iter = ReferenceParents.CreateIterator(); Iter; ++Iter )
+    {
+        if ( Iter.Value() == ReferenceNodeId )
+            Iter.RemoveCurrent();
+    }
+
+    RemoveReference( Key );
+}
+
+void
+FHoudiniEngineInputMeshCache::RemoveReference( const FHoudiniEngineInputMeshCacheKey & Key )
+{
+    FSharedNode * SharedNode = SharedNodes.Find( Key );
+    if ( !SharedNode )
+        return;
+
+    if ( --SharedNode->ReferenceCount > 0 )
+        return;
+
+    // Last reference is gone, the mesh is no longer used by any input.
+    for ( HAPI_NodeId OwnedNodeId : SharedNode->OwnedNodeIds )
+    {
+        if ( FHoudiniEngineUtils::IsHoudiniNodeValid( OwnedNodeId ) )
+            FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), OwnedNodeId );
+    }
+
+    SharedNodes.Remove( Key );
+}
+
+void
+FHoudiniEngineInputMeshCache::Reset()
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    SharedNodes.Empty();
+    References.Empty();
+    ReferenceParents.Empty();
+}
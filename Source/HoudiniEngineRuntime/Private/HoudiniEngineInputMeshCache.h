@@ -0,0 +1,113 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "HAPI_Common.h"
+
+/** Identity of an uploaded input mesh: the mesh asset, the export options and a hash of everything that is marshalled. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniEngineInputMeshCacheKey
+{
+    FHoudiniEngineInputMeshCacheKey();
+
+    /** Comparison operator, used by hashing containers. **/
+    bool operator==( const FHoudiniEngineInputMeshCacheKey & Other ) const;
+
+    /** Path of the static mesh asset. **/
+    FString MeshPath;
+
+    /** Hash of the raw mesh data of the exported LODs, materials, sockets and marshalling settings. **/
+    uint32 ContentHash;
+
+    /** Export options. **/
+    bool bExportAllLODs;
+    bool bExportSockets;
+};
+
+/** Function used to produce a hash value for the key. **/
+HOUDINIENGINERUNTIME_API uint32 GetTypeHash( const FHoudiniEngineInputMeshCacheKey & Key );
+
+/** Session wide cache of uploaded input meshes. Each mesh is uploaded once to a shared input node, and every input **/
+/** using it gets its own object_merge reference node, which can be transformed independently. Shared nodes are **/
+/** reference counted and destroyed once their last reference node is destroyed. **/
+class HOUDINIENGINERUNTIME_API FHoudiniEngineInputMeshCache
+{
+    public:
+
+        /** Return the shared node uploaded for the given key, or -1 if there is none. **/
+        static HAPI_NodeId FindSharedNode( const FHoudiniEngineInputMeshCacheKey & Key );
+
+        /** Register a freshly uploaded shared node, along with the nodes to destroy when it is released. **/
+        static bool AddSharedNode(
+            const FHoudiniEngineInputMeshCacheKey & Key, HAPI_NodeId SharedNodeId, const TArray< HAPI_NodeId > & OwnedNodeIds );
+
+        /** Point ReferenceNodeId at the shared node of the given key. If ReferenceNodeId is not a reference node yet, **/
+        /** a new one is created and its parent OBJ node is added to OutCreatedNodeIds. Return true on success. **/
+        static bool CreateReference(
+            const FHoudiniEngineInputMeshCacheKey & Key, HAPI_NodeId & ReferenceNodeId, TArray< HAPI_NodeId > & OutCreatedNodeIds );
+
+        /** Return true if the given node is a reference node. **/
+        static bool IsReference( HAPI_NodeId NodeId );
+
+        /** Called before a node is destroyed. If it is a reference node or its parent, the reference is released. **/
+        static void ReleaseReference( HAPI_NodeId NodeId );
+
+        /** Forget all shared nodes, used when the session goes away. **/
+        static void Reset();
+
+    protected:
+
+        /** Uploaded input mesh shared by reference nodes. **/
+        struct FSharedNode
+        {
+            FSharedNode() : NodeId( -1 ), ReferenceCount( 0 ) {}
+
+            /** Node holding the geometry and its absolute path. **/
+            HAPI_NodeId NodeId;
+            FString NodePath;
+
+            /** Nodes created by the upload. **/
+            TArray< HAPI_NodeId > OwnedNodeIds;
+
+            /** Number of reference nodes. **/
+            int32 ReferenceCount;
+        };
+
+        /** Remove a reference to the given key, destroying the shared node if it was the last one. **/
+        /** Must be called with the lock held. **/
+        static void RemoveReference( const FHoudiniEngineInputMeshCacheKey & Key );
+
+    protected:
+
+        /** Synchronization primitive. **/
+        static FCriticalSection CriticalSection;
+
+        /** Shared nodes, by key. **/
+        static TMap< FHoudiniEngineInputMeshCacheKey, FSharedNode > SharedNodes;
+
+        /** Keys referenced by each reference node. **/
+        static TMap< HAPI_NodeId, FHoudiniEngineInputMeshCacheKey > References;
+
+        /** Reference nodes, by parent OBJ node. **/
+        static TMap< HAPI_NodeId, HAPI_NodeId > ReferenceParents;
+};
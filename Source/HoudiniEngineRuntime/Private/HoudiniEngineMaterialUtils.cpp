@@ -33,6 +33,7 @@
 #include "Materials/MaterialInstance.h"
 #include "Materials/MaterialInstanceConstant.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Async/ParallelFor.h"
 //#include "MetaData.h"
 #if WITH_EDITOR
     #include "Materials/Material.h"
@@ -536,11 +537,12 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentDiffuse(
                 GetUniqueMaterialShopName( AssetId, MaterialInfo.nodeId, NodePath );
 
                 // Reuse existing diffuse texture, or create new one.
+                bool bTextureDiffuseUpdated = true;
                 TextureDiffuse = FHoudiniEngineMaterialUtils::CreateUnrealTexture(
                     TextureDiffuse, ImageInfo,
                     TextureDiffusePackage, TextureDiffuseName, ImageBuffer,
                     HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE,
-                    CreateTexture2DParameters, TEXTUREGROUP_World, NodePath );
+                    CreateTexture2DParameters, TEXTUREGROUP_World, NodePath, &bTextureDiffuseUpdated );
 
                 if ( BakeMode == EBakeMode::CookToTemp )
                     TextureDiffuse->SetFlags( RF_Public | RF_Standalone );
@@ -565,8 +567,11 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentDiffuse(
                 if ( bCreatedNewTextureDiffuse )
                     FAssetRegistryModule::AssetCreated( TextureDiffuse );
 
-                TextureDiffuse->PreEditChange( nullptr );
-                TextureDiffuse->PostEditChange();
+                if ( bTextureDiffuseUpdated )
+                {
+                    TextureDiffuse->PreEditChange( nullptr );
+                    TextureDiffuse->PostEditChange();
+                }
                 TextureDiffuse->MarkPackageDirty();
             }
         }
@@ -799,12 +804,13 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentOpacityMask(
                 GetUniqueMaterialShopName( AssetId, MaterialInfo.nodeId, NodePath );
 
                 // Reuse existing opacity texture, or create new one.
+                bool bTextureOpacityUpdated = true;
                 TextureOpacity = FHoudiniEngineMaterialUtils::CreateUnrealTexture(
                     TextureOpacity, ImageInfo,
                     TextureOpacityPackage, TextureOpacityName, ImageBuffer,
                     HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK,
                     CreateTexture2DParameters,
-                    TEXTUREGROUP_World, NodePath );
+                    TEXTUREGROUP_World, NodePath, &bTextureOpacityUpdated );
 
                 if ( BakeMode == EBakeMode::CookToTemp )
                     TextureOpacity->SetFlags(RF_Public | RF_Standalone);
@@ -849,8 +855,11 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentOpacityMask(
                 if ( bCreatedNewTextureOpacity )
                     FAssetRegistryModule::AssetCreated( TextureOpacity );
 
-                TextureOpacity->PreEditChange( nullptr );
-                TextureOpacity->PostEditChange();
+                if ( bTextureOpacityUpdated )
+                {
+                    TextureOpacity->PreEditChange( nullptr );
+                    TextureOpacity->PostEditChange();
+                }
                 TextureOpacity->MarkPackageDirty();
 
                 bExpressionCreated = true;
@@ -1309,11 +1318,12 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
                     GetUniqueMaterialShopName( AssetId, MaterialInfo.nodeId, NodePath );
 
                     // Reuse existing normal texture, or create new one.
+                    bool bTextureNormalUpdated = true;
                     TextureNormal = FHoudiniEngineMaterialUtils::CreateUnrealTexture(
                         TextureNormal, ImageInfo,
                         TextureNormalPackage, TextureNormalName, ImageBuffer,
                         HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL, CreateTexture2DParameters,
-                        TEXTUREGROUP_WorldNormalMap, NodePath );
+                        TEXTUREGROUP_WorldNormalMap, NodePath, &bTextureNormalUpdated );
 
                     if ( BakeMode == EBakeMode::CookToTemp )
                         TextureNormal->SetFlags( RF_Public | RF_Standalone );
@@ -1348,8 +1358,11 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
                     if ( bCreatedNewTextureNormal )
                         FAssetRegistryModule::AssetCreated( TextureNormal );
 
-                    TextureNormal->PreEditChange( nullptr );
-                    TextureNormal->PostEditChange();
+                    if ( bTextureNormalUpdated )
+                    {
+                        TextureNormal->PreEditChange( nullptr );
+                        TextureNormal->PostEditChange();
+                    }
                     TextureNormal->MarkPackageDirty();
 
                     bExpressionCreated = true;
@@ -2181,13 +2194,102 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentEmissive(
     return bExpressionCreated;
 }
 
+/** Number of image rows converted by each task. **/
+static const uint32 HoudiniTextureRowsPerTask = 64;
+
+/** Convert a Houdini RGBA8 image into a vertically flipped BGRA8 image. Pixels are processed as 32 bit words with **/
+/** branch free masks so that the inner loop vectorizes, and blocks of rows are converted in parallel. Returns true **/
+/** if any pixel has an alpha value other than 255. **/
+static bool
+HoudiniConvertImageRGBAToFlippedBGRA( const uint8 * SrcData, uint32 Width, uint32 Height, bool bUseAlpha, uint8 * DestData )
+{
+    // Pixels are read as little endian words: R is in the lowest byte, A in the highest.
+    const uint32 AlphaMask = 0xFF000000u;
+    const uint32 ForcedAlpha = bUseAlpha ? 0u : AlphaMask;
+
+    const int32 NumTasks = (int32) ( ( Height + HoudiniTextureRowsPerTask - 1 ) / HoudiniTextureRowsPerTask );
+    TArray< uint32 > TaskAlpha;
+    TaskAlpha.Init( AlphaMask, NumTasks );
+
+    ParallelFor( NumTasks, [ & ]( int32 TaskIdx )
+    {
+        const uint32 RowStart = (uint32) TaskIdx * HoudiniTextureRowsPerTask;
+        const uint32 RowEnd = FMath::Min( RowStart + HoudiniTextureRowsPerTask, Height );
+
+        uint32 Alpha = AlphaMask;
+        for ( uint32 y = RowStart; y < RowEnd; y++ )
+        {
+            const uint32 * RESTRICT SrcRow = (const uint32 *)( SrcData + (SIZE_T) y * Width * 4 );
+            uint32 * RESTRICT DestRow = (uint32 *)( DestData + (SIZE_T) ( Height - 1 - y ) * Width * sizeof( FColor ) );
+
+            for ( uint32 x = 0; x < Width; x++ )
+            {
+                const uint32 Pixel = SrcRow[ x ];
+
+                // Swap R and B, keep G and A.
+                DestRow[ x ] = ( ( Pixel & 0xFFu ) << 16 ) | ( ( Pixel >> 16 ) & 0xFFu ) | ( Pixel & 0xFF00FF00u ) | ForcedAlpha;
+                Alpha &= Pixel;
+            }
+        }
+
+        TaskAlpha[ TaskIdx ] = Alpha & AlphaMask;
+    } );
+
+    if ( !bUseAlpha )
+        return false;
+
+    // See if there is an actual alpha value in the texture or if we can ignore the texture alpha
+    for ( uint32 Alpha : TaskAlpha )
+    {
+        if ( Alpha != AlphaMask )
+            return true;
+    }
+
+    return false;
+}
+
 UTexture2D *
 FHoudiniEngineMaterialUtils::CreateUnrealTexture(
     UTexture2D * ExistingTexture, const HAPI_ImageInfo & ImageInfo,
     UPackage * Package, const FString & TextureName,
     const TArray< char > & ImageBuffer, const FString & TextureType,
-    const FCreateTexture2DParameters & TextureParameters, TextureGroup LODGroup, const FString& NodePath )
+    const FCreateTexture2DParameters & TextureParameters, TextureGroup LODGroup, const FString& NodePath,
+    bool * bOutTextureUpdated /* = nullptr */ )
 {
+    if ( bOutTextureUpdated )
+        *bOutTextureUpdated = true;
+
+    // Hash everything the texture is generated from, the image data is only re-imported if it changed.
+    uint32 ImageHash = FCrc::MemCrc32( ImageBuffer.GetData(), ImageBuffer.Num() );
+    ImageHash = FCrc::MemCrc32( &ImageInfo.xRes, sizeof( ImageInfo.xRes ), ImageHash );
+    ImageHash = FCrc::MemCrc32( &ImageInfo.yRes, sizeof( ImageInfo.yRes ), ImageHash );
+    ImageHash = FCrc::StrCrc32( *TextureType, ImageHash );
+    ImageHash = FCrc::StrCrc32( *NodePath, ImageHash );
+
+    const uint8 TextureFlags[] =
+    {
+        (uint8) TextureParameters.bUseAlpha, (uint8) TextureParameters.bSRGB,
+        (uint8) TextureParameters.bDeferCompression, (uint8) TextureParameters.CompressionSettings,
+        (uint8) LODGroup
+    };
+    ImageHash = FCrc::MemCrc32( TextureFlags, sizeof( TextureFlags ), ImageHash );
+
+    const FString ImageHashString = FString::Printf( TEXT( "%08x" ), ImageHash );
+
+#if WITH_EDITORONLY_DATA
+    if ( ExistingTexture && Package && ExistingTexture->Source.IsValid() )
+    {
+        UMetaData * MetaData = Package->GetMetaData();
+        if ( MetaData && MetaData->GetValue( ExistingTexture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH ) == ImageHashString )
+        {
+            if ( bOutTextureUpdated )
+                *bOutTextureUpdated = false;
+
+            return ExistingTexture;
+        }
+    }
+#endif
+
     UTexture2D * Texture = nullptr;
     if ( ExistingTexture )
     {
@@ -2213,6 +2315,8 @@ FHoudiniEngineMaterialUtils::CreateUnrealTexture(
         Package, Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE, *TextureType );
     FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
         Package, Texture, HAPI_UNREAL_PACKAGE_META_NODE_PATH, *NodePath );
+    FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
+        Package, Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH, *ImageHashString );
 
 #if WITH_EDITORONLY_DATA
 
@@ -2222,51 +2326,13 @@ FHoudiniEngineMaterialUtils::CreateUnrealTexture(
     // Lock the texture.
     uint8 * MipData = Texture->Source.LockMip( 0 );
 
-    // Create base map.
-    uint8* DestPtr = nullptr;
+    // Create base map, flipped and swizzled, and find out if alpha is used in the same pass.
     uint32 SrcWidth = ImageInfo.xRes;
     uint32 SrcHeight = ImageInfo.yRes;
-    const char * SrcData = &ImageBuffer[ 0 ];
-
-    for ( uint32 y = 0; y < SrcHeight; y++ )
-    {
-        DestPtr = &MipData[ ( SrcHeight - 1 - y ) * SrcWidth * sizeof( FColor ) ];
-
-        for ( uint32 x = 0; x < SrcWidth; x++ )
-        {
-            uint32 DataOffset = y * SrcWidth * 4 + x * 4;
+    const uint8 * SrcData = (const uint8 *) ImageBuffer.GetData();
 
-            *DestPtr++ = *(uint8*)( SrcData + DataOffset + 2 ); // B
-            *DestPtr++ = *(uint8*)( SrcData + DataOffset + 1 ); // G
-            *DestPtr++ = *(uint8*)( SrcData + DataOffset + 0 ); // R
-
-            if ( TextureParameters.bUseAlpha )
-                *DestPtr++ = *(uint8*)( SrcData + DataOffset + 3 ); // A
-            else
-                *DestPtr++ = 0xFF;
-        }
-    }
-
-    bool bHasAlphaValue = false;
-    if ( TextureParameters.bUseAlpha )
-    {
-        // See if there is an actual alpha value in the texture or if we can ignore the texture alpha
-        for ( uint32 y = 0; y < SrcHeight; y++ )
-        {
-            for ( uint32 x = 0; x < SrcWidth; x++ )
-            {
-                uint32 DataOffset = y * SrcWidth * 4 + x * 4;
-                if (*(uint8*)(SrcData + DataOffset + 3) != 0xFF)
-                {
-                    bHasAlphaValue = true;
-                    break;
-                }
-            }
-
-            if ( bHasAlphaValue )
-                break;
-        }
-    }
+    bool bHasAlphaValue = HoudiniConvertImageRGBAToFlippedBGRA(
+        SrcData, SrcWidth, SrcHeight, TextureParameters.bUseAlpha, MipData );
 
     // Unlock the texture.
     Texture->Source.UnlockMip( 0 );
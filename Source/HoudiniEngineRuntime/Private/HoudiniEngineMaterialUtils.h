@@ -74,12 +74,14 @@ public:
 
 #if WITH_EDITOR
 
-    /** Create a texture from given information. **/
+    /** Create a texture from given information. An existing texture generated from identical image data and **/
+    /** parameters is returned untouched, bOutTextureUpdated tells whether the texture was (re)initialized. **/
     static UTexture2D * CreateUnrealTexture(
         UTexture2D * ExistingTexture, const HAPI_ImageInfo & ImageInfo,
         UPackage * Package, const FString & TextureName,
         const TArray< char > & ImageBuffer, const FString & TextureType,
-        const FCreateTexture2DParameters & TextureParameters, TextureGroup LODGroup, const FString& NodePath );
+        const FCreateTexture2DParameters & TextureParameters, TextureGroup LODGroup, const FString& NodePath,
+        bool * bOutTextureUpdated = nullptr );
 
     /** Create various material components. **/
     static bool CreateMaterialComponentDiffuse(
@@ -0,0 +1,2748 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineMockApi.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+
+#include <string>
+
+/** Name of the single asset exposed by every mock asset library. **/
+#define HAPI_UNREAL_MOCK_ASSET_NAME                     "Mock::Object/houdini_mock_scene"
+
+/** Spacing of mesh grid points and heightfield voxels, in Houdini units. **/
+#define HAPI_UNREAL_MOCK_CELL_SIZE                      0.1f
+#define HAPI_UNREAL_MOCK_VOXEL_SIZE                     1.0f
+
+FHoudiniEngineMockApiSettings::FHoudiniEngineMockApiSettings()
+    : MeshObjectCount( 4 )
+    , MeshPartsPerObject( 2 )
+    , MeshResolution( 64 )
+    , HeightfieldSize( 0 )
+    , HeightfieldLayerCount( 2 )
+    , InstancerCount( 1 )
+    , InstancesPerInstancer( 256 )
+    , MaterialCount( 2 )
+    , TextureResolution( 256 )
+    , CallLatencyMicroseconds( 0.0f )
+    , BandwidthMegabytesPerSecond( 0.0f )
+    , CookMilliseconds( 0.0f )
+    , bDirtyOnEveryCook( true )
+{}
+
+void
+FHoudiniEngineMockApiSettings::ParseCommandLine( const TCHAR * CommandLine )
+{
+    FParse::Value( CommandLine, TEXT( "HoudiniMockObjects=" ), MeshObjectCount );
+    FParse::Value( CommandLine, TEXT( "HoudiniMockParts=" ), MeshPartsPerObject );
+    FParse::Value( CommandLine, TEXT( "HoudiniMockMeshResolution=" ), MeshResolution );
+    FParse::Value( CommandLine, TEXT( "HoudiniMockHeightfieldSize=" ), HeightfieldSize );
+    FParse::Value( CommandLine, TEXT( "HoudiniMockHeightfieldLayers=" ), HeightfieldLayerCount );
+    FParse::Value( CommandLine, TEXT( "HoudiniMockInstancers=" ), InstancerCount );
+    FParse::Value( CommandLine, TEXT( "HoudiniMockInstances=" ), InstancesPerInstancer );
+    FParse::Value( CommandLine, TEXT( "HoudiniMockMaterials=" ), MaterialCount );
+    FParse::Value( CommandLine, TEXT( "HoudiniMockTextureResolution=" ), TextureResolution );
+    FParse::Value( CommandLine, TEXT( "HoudiniMockLatencyUs=" ), CallLatencyMicroseconds );
+    FParse::Value( CommandLine, TEXT( "HoudiniMockBandwidthMBs=" ), BandwidthMegabytesPerSecond );
+    FParse::Value( CommandLine, TEXT( "HoudiniMockCookMs=" ), CookMilliseconds );
+    FParse::Bool( CommandLine, TEXT( "HoudiniMockDirtyOnEveryCook=" ), bDirtyOnEveryCook );
+
+    MeshObjectCount = FMath::Max( MeshObjectCount, 0 );
+    MeshPartsPerObject = FMath::Max( MeshPartsPerObject, 1 );
+    MeshResolution = FMath::Max( MeshResolution, 1 );
+    HeightfieldSize = HeightfieldSize > 0 ? FMath::Max( HeightfieldSize, 2 ) : 0;
+    HeightfieldLayerCount = FMath::Max( HeightfieldLayerCount, 0 );
+    InstancerCount = FMath::Max( InstancerCount, 0 );
+    InstancesPerInstancer = FMath::Max( InstancesPerInstancer, 1 );
+    MaterialCount = FMath::Max( MaterialCount, 0 );
+    TextureResolution = FMath::Max( TextureResolution, 0 );
+}
+
+/** Kind of node in the synthetic scene. **/
+enum class EHoudiniMockNodeKind : uint8
+{
+    /** Instantiated mock asset, an OBJ subnet. **/
+    Asset,
+
+    /** Object of an asset and its display geo. **/
+    Object,
+    Geo,
+
+    /** Material of an asset. **/
+    Material,
+
+    /** Node created by the plugin, input and utility nodes. **/
+    Generic
+};
+
+/** Kind of generated content of an asset object. **/
+enum class EHoudiniMockObjectKind : uint8
+{
+    Mesh,
+    Heightfield,
+    Instancer
+};
+
+/** Node of the synthetic scene. **/
+struct FHoudiniMockNode
+{
+    FHoudiniMockNode()
+        : Kind( EHoudiniMockNodeKind::Generic )
+        , Type( HAPI_NODETYPE_SOP )
+        , Id( -1 )
+        , ParentId( -1 )
+        , AssetId( -1 )
+        , Index( -1 )
+        , CookCount( 0 )
+        , bImageRendered( false )
+    {
+        FMemory::Memzero< HAPI_ImageInfo >( ImageInfo );
+    }
+
+    EHoudiniMockNodeKind Kind;
+    HAPI_NodeType Type;
+
+    HAPI_NodeId Id;
+    HAPI_NodeId ParentId;
+
+    /** Asset this node was generated for, -1 for generic nodes. **/
+    HAPI_NodeId AssetId;
+
+    /** Index of the object or material within its asset. **/
+    int32 Index;
+
+    /** Node name and absolute path. **/
+    FString Name;
+    FString Path;
+
+    /** Number of cooks, for generated nodes this is the cook count of the asset. **/
+    int32 CookCount;
+
+    /** Child nodes, for assets these are the objects. **/
+    TArray< HAPI_NodeId > Children;
+
+    /** Materials of an asset. **/
+    TArray< HAPI_NodeId > Materials;
+
+    /** Connected inputs. **/
+    TMap< int32, HAPI_NodeId > Inputs;
+
+    /** Parts uploaded to a generic node. **/
+    TMap< HAPI_PartId, HAPI_PartInfo > UploadedParts;
+
+    /** Rendered image of a material. **/
+    HAPI_ImageInfo ImageInfo;
+    bool bImageRendered;
+};
+
+/** Mock implementation of the Houdini Engine API entry points and the synthetic scene they serve. **/
+struct FHoudiniMockHapi
+{
+    /** Simulate the cost of a session round trip carrying the given number of bytes. **/
+    static void RoundTrip( int64 PayloadBytes = 0 );
+
+    /** Helpers, must be called with the lock held. **/
+    static HAPI_StringHandle Intern( const FString & String );
+    static FHoudiniMockNode * FindNode( HAPI_NodeId NodeId );
+    static HAPI_NodeId AddNode( EHoudiniMockNodeKind Kind, HAPI_NodeType Type, HAPI_NodeId ParentId, const FString & Name );
+    static void RemoveNode( HAPI_NodeId NodeId );
+    static HAPI_NodeId CreateAsset( const FString & Name );
+    static bool IsDirty( const FHoudiniMockNode & Node );
+    static EHoudiniMockObjectKind GetObjectKind( int32 ObjectIndex );
+    static int32 GetPartCount( const FHoudiniMockNode & Geo );
+    static int32 GetPartResolution( const FHoudiniMockNode & Geo, HAPI_PartId PartId );
+    static bool GetPartInfo( const FHoudiniMockNode & Geo, HAPI_PartId PartId, HAPI_PartInfo & PartInfo );
+    static void GetPartAttributeNames( const FHoudiniMockNode & Geo, HAPI_PartId PartId, HAPI_AttributeOwner Owner, TArray< FString > & Names );
+    static bool GetPartAttributeInfo( const FHoudiniMockNode & Geo, HAPI_PartId PartId, const char * Name, HAPI_AttributeOwner Owner, HAPI_AttributeInfo & AttributeInfo );
+    static void GetObjectTransform( const FHoudiniMockNode & Node, HAPI_Transform & Transform );
+    static void GetInstanceTransform( int32 InstanceIdx, HAPI_Transform & Transform );
+    static void FillGeoInfo( const FHoudiniMockNode & Geo, HAPI_GeoInfo & GeoInfo );
+    static void FillObjectInfo( const FHoudiniMockNode & Object, HAPI_ObjectInfo & ObjectInfo );
+    static bool FillParmInfo( const FHoudiniMockNode & Node, HAPI_ParmId ParmId, HAPI_ParmInfo & ParmInfo );
+    static int32 GetParmCount( const FHoudiniMockNode & Node );
+
+    /** Sessions. **/
+    static HAPI_Result CreateInProcessSession( HAPI_Session * session );
+    static HAPI_Result CreateThriftSocketSession( HAPI_Session * session, const char * host_name, int port );
+    static HAPI_Result CreateThriftNamedPipeSession( HAPI_Session * session, const char * pipe_name );
+    static HAPI_Result StartThriftSocketServer( const HAPI_ThriftServerOptions * options, int port, HAPI_ProcessId * process_id );
+    static HAPI_Result StartThriftNamedPipeServer( const HAPI_ThriftServerOptions * options, const char * pipe_name, HAPI_ProcessId * process_id );
+    static HAPI_Result IsSessionValid( const HAPI_Session * session );
+    static HAPI_Result CloseSession( const HAPI_Session * session );
+    static HAPI_Result Initialize(
+        const HAPI_Session * session, const HAPI_CookOptions * cook_options, HAPI_Bool use_cooking_thread,
+        int cooking_thread_stack_size, const char * houdini_environment_files, const char * otl_search_path,
+        const char * dso_search_path, const char * image_dso_search_path, const char * audio_dso_search_path );
+    static HAPI_Result IsInitialized( const HAPI_Session * session );
+    static HAPI_Result Cleanup( const HAPI_Session * session );
+    static HAPI_Result GetEnvInt( HAPI_EnvIntType int_type, int * value );
+    static HAPI_Result GetSessionEnvInt( const HAPI_Session * session, HAPI_SessionEnvIntType int_type, int * value );
+    static HAPI_Result SetServerEnvString( const HAPI_Session * session, const char * variable_name, const char * value );
+    static HAPI_Result SetTime( const HAPI_Session * session, float time );
+    static HAPI_Result GetStatus( const HAPI_Session * session, HAPI_StatusType status_type, int * status );
+    static HAPI_Result GetStatusStringBufLength(
+        const HAPI_Session * session, HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity, int * buffer_length );
+    static HAPI_Result GetStatusString( const HAPI_Session * session, HAPI_StatusType status_type, char * string_value, int length );
+    static HAPI_Result GetStringBufLength( const HAPI_Session * session, HAPI_StringHandle string_handle, int * buffer_length );
+    static HAPI_Result GetString( const HAPI_Session * session, HAPI_StringHandle string_handle, char * string_value, int length );
+
+    /** Asset libraries. **/
+    static HAPI_Result LoadAssetLibraryFromFile(
+        const HAPI_Session * session, const char * file_path, HAPI_Bool allow_overwrite, HAPI_AssetLibraryId * library_id );
+    static HAPI_Result LoadAssetLibraryFromMemory(
+        const HAPI_Session * session, const char * library_buffer, int library_buffer_length, HAPI_Bool allow_overwrite,
+        HAPI_AssetLibraryId * library_id );
+    static HAPI_Result GetAvailableAssetCount( const HAPI_Session * session, HAPI_AssetLibraryId library_id, int * asset_count );
+    static HAPI_Result GetAvailableAssets(
+        const HAPI_Session * session, HAPI_AssetLibraryId library_id, HAPI_StringHandle * asset_names_array, int asset_count );
+
+    /** Nodes. **/
+    static HAPI_Result CreateNode(
+        const HAPI_Session * session, HAPI_NodeId parent_node_id, const char * operator_name, const char * node_label,
+        HAPI_Bool cook_on_creation, HAPI_NodeId * new_node_id );
+    static HAPI_Result CreateInputNode( const HAPI_Session * session, HAPI_NodeId * node_id, const char * name );
+    static HAPI_Result DeleteNode( const HAPI_Session * session, HAPI_NodeId node_id );
+    static HAPI_Result CookNode( const HAPI_Session * session, HAPI_NodeId node_id, const HAPI_CookOptions * cook_options );
+    static HAPI_Result GetNodeInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeInfo * node_info );
+    static HAPI_Result IsNodeValid( const HAPI_Session * session, HAPI_NodeId node_id, int unique_node_id, HAPI_Bool * answer );
+    static HAPI_Result GetNodePath(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeId relative_to_node_id, HAPI_StringHandle * path );
+    static HAPI_Result ComposeChildNodeList(
+        const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_NodeTypeBits node_type_filter,
+        HAPI_NodeFlagsBits node_flags_filter, HAPI_Bool recursive, int * count );
+    static HAPI_Result GetComposedChildNodeList(
+        const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_NodeId * child_node_ids_array, int count );
+    static HAPI_Result ConnectNodeInput( const HAPI_Session * session, HAPI_NodeId node_id, int input_index, HAPI_NodeId node_id_to_connect );
+    static HAPI_Result DisconnectNodeInput( const HAPI_Session * session, HAPI_NodeId node_id, int input_index );
+    static HAPI_Result QueryNodeInput( const HAPI_Session * session, HAPI_NodeId node_to_query, int input_index, HAPI_NodeId * connected_node_id );
+    static HAPI_Result GetAssetInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_AssetInfo * asset_info );
+
+    /** Parameters. **/
+    static HAPI_Result GetParameters( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmInfo * parm_infos_array, int start, int length );
+    static HAPI_Result GetParmInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, HAPI_ParmInfo * parm_info );
+    static HAPI_Result GetParmIdFromName( const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_ParmId * parm_id );
+    static HAPI_Result GetParmWithTag( const HAPI_Session * session, HAPI_NodeId node_id, const char * tag_name, HAPI_ParmId * parm_id );
+    static HAPI_Result GetParmFloatValues( const HAPI_Session * session, HAPI_NodeId node_id, float * values_array, int start, int length );
+    static HAPI_Result GetParmIntValues( const HAPI_Session * session, HAPI_NodeId node_id, int * values_array, int start, int length );
+    static HAPI_Result GetParmStringValues(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_Bool evaluate, HAPI_StringHandle * values_array, int start, int length );
+    static HAPI_Result SetParmFloatValue( const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, float value );
+    static HAPI_Result SetParmFloatValues( const HAPI_Session * session, HAPI_NodeId node_id, const float * values_array, int start, int length );
+    static HAPI_Result SetParmIntValue( const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, int value );
+    static HAPI_Result SetParmIntValues( const HAPI_Session * session, HAPI_NodeId node_id, const int * values_array, int start, int length );
+    static HAPI_Result SetParmStringValue( const HAPI_Session * session, HAPI_NodeId node_id, const char * value, HAPI_ParmId parm_id, int index );
+    static HAPI_Result SetParmNodeValue( const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_NodeId value );
+
+    /** Objects. **/
+    static HAPI_Result ComposeObjectList( const HAPI_Session * session, HAPI_NodeId parent_node_id, const char * categories, int * object_count );
+    static HAPI_Result GetComposedObjectList(
+        const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_ObjectInfo * object_infos_array, int start, int length );
+    static HAPI_Result GetComposedObjectTransforms(
+        const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_RSTOrder rst_order, HAPI_Transform * transform_array,
+        int start, int length );
+    static HAPI_Result GetObjectInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ObjectInfo * object_info );
+    static HAPI_Result GetObjectTransform(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeId relative_to_node_id, HAPI_RSTOrder rst_order,
+        HAPI_Transform * transform );
+    static HAPI_Result SetObjectTransform( const HAPI_Session * session, HAPI_NodeId node_id, const HAPI_TransformEuler * trans );
+
+    /** Geometry output. **/
+    static HAPI_Result GetDisplayGeoInfo( const HAPI_Session * session, HAPI_NodeId object_node_id, HAPI_GeoInfo * geo_info );
+    static HAPI_Result GetGeoInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_GeoInfo * geo_info );
+    static HAPI_Result GetPartInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_PartInfo * part_info );
+    static HAPI_Result GetAttributeNames(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_AttributeOwner owner,
+        HAPI_StringHandle * attribute_names_array, int count );
+    static HAPI_Result GetAttributeInfo(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeOwner owner,
+        HAPI_AttributeInfo * attr_info );
+    static HAPI_Result GetAttributeFloatData(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info,
+        int stride, float * data_array, int start, int length );
+    static HAPI_Result GetAttributeIntData(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info,
+        int stride, int * data_array, int start, int length );
+    static HAPI_Result GetAttributeStringData(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info,
+        HAPI_StringHandle * data_array, int start, int length );
+    static HAPI_Result GetVertexList( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * vertex_list_array, int start, int length );
+    static HAPI_Result GetFaceCounts( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * face_counts_array, int start, int length );
+    static HAPI_Result GetGroupNames(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_GroupType group_type, HAPI_StringHandle * group_names_array, int group_count );
+    static HAPI_Result GetGroupCountOnPackedInstancePart(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * pointGroupCount, int * primitiveGroupCount );
+    static HAPI_Result GetMaterialNodeIdsOnFaces(
+        const HAPI_Session * session, HAPI_NodeId geometry_node_id, HAPI_PartId part_id, HAPI_Bool * are_all_the_same,
+        HAPI_NodeId * material_ids_array, int start, int length );
+    static HAPI_Result GetInstancedPartIds(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_PartId * instanced_parts_array, int start, int length );
+    static HAPI_Result GetInstancerPartTransforms(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_RSTOrder rst_order,
+        HAPI_Transform * transforms_array, int start, int length );
+    static HAPI_Result GetVolumeInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_VolumeInfo * volume_info );
+    static HAPI_Result GetVolumeBounds(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * x_min, float * y_min, float * z_min,
+        float * x_max, float * y_max, float * z_max, float * x_center, float * y_center, float * z_center );
+    static HAPI_Result GetHeightFieldData(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * values_array, int start, int length );
+
+    /** Geometry input, the data is accepted and discarded. **/
+    static HAPI_Result SetPartInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_PartInfo * part_info );
+    static HAPI_Result AddAttribute(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info );
+    static HAPI_Result SetAttributeFloatData(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info,
+        const float * data_array, int start, int length );
+    static HAPI_Result SetAttributeIntData(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info,
+        const int * data_array, int start, int length );
+    static HAPI_Result SetAttributeStringData(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info,
+        const char ** data_array, int start, int length );
+    static HAPI_Result SetVertexList(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * vertex_list_array, int start, int length );
+    static HAPI_Result SetFaceCounts(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * face_counts_array, int start, int length );
+    static HAPI_Result AddGroup(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name );
+    static HAPI_Result SetGroupMembership(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name,
+        const int * membership_array, int start, int length );
+    static HAPI_Result CommitGeo( const HAPI_Session * session, HAPI_NodeId node_id );
+    static HAPI_Result RevertGeo( const HAPI_Session * session, HAPI_NodeId node_id );
+    static HAPI_Result SetCurveInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_CurveInfo * info );
+    static HAPI_Result SetCurveCounts( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * counts_array, int start, int length );
+    static HAPI_Result SetCurveOrders( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * orders_array, int start, int length );
+    static HAPI_Result SetCurveKnots( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const float * knots_array, int start, int length );
+    static HAPI_Result SetVolumeInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_VolumeInfo * volume_info );
+    static HAPI_Result SetHeightFieldData(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const float * values_array, int start, int length );
+    static HAPI_Result SetVolumeTileFloatData(
+        const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_VolumeTileInfo * tile, const float * values_array, int length );
+
+    /** Materials. **/
+    static HAPI_Result GetMaterialInfo( const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_MaterialInfo * material_info );
+    static HAPI_Result RenderTextureToImage( const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_ParmId parm_id );
+    static HAPI_Result GetImageInfo( const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_ImageInfo * image_info );
+    static HAPI_Result SetImageInfo( const HAPI_Session * session, HAPI_NodeId material_node_id, const HAPI_ImageInfo * image_info );
+    static HAPI_Result GetImagePlaneCount( const HAPI_Session * session, HAPI_NodeId material_node_id, int * image_plane_count );
+    static HAPI_Result GetImagePlanes(
+        const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_StringHandle * image_planes_array, int image_plane_count );
+    static HAPI_Result ExtractImageToMemory(
+        const HAPI_Session * session, HAPI_NodeId material_node_id, const char * image_file_format_name, const char * image_planes,
+        int * buffer_size );
+    static HAPI_Result GetImageMemoryBuffer( const HAPI_Session * session, HAPI_NodeId material_node_id, char * buffer, int length );
+
+    /** Math utilities, computed with Unreal math in an SRT order. **/
+    static HAPI_Result ConvertTransformQuatToMatrix( const HAPI_Session * session, const HAPI_Transform * transform, float * matrix );
+    static HAPI_Result ConvertMatrixToQuat( const HAPI_Session * session, const float * matrix, HAPI_RSTOrder rst_order, HAPI_Transform * transform_out );
+    static HAPI_Result ConvertMatrixToEuler(
+        const HAPI_Session * session, const float * matrix, HAPI_RSTOrder rst_order, HAPI_XYZOrder rot_order, HAPI_TransformEuler * transform_out );
+    static HAPI_Result ConvertTransformEulerToMatrix( const HAPI_Session * session, const HAPI_TransformEuler * transform, float * matrix );
+
+    /** Synchronization primitive. **/
+    static FCriticalSection CriticalSection;
+
+    /** Bound settings. **/
+    static FHoudiniEngineMockApiSettings Settings;
+    static bool bBound;
+
+    /** Session state. **/
+    static bool bSessionOpen;
+    static bool bInitialized;
+
+    /** Synthetic scene. **/
+    static TMap< HAPI_NodeId, FHoudiniMockNode > Nodes;
+    static HAPI_NodeId NextNodeId;
+    static int32 NextAssetIndex;
+    static HAPI_AssetLibraryId NextLibraryId;
+
+    /** Result of the last ComposeChildNodeList call. **/
+    static TArray< HAPI_NodeId > ComposedChildNodes;
+
+    /** Interned strings, handle 0 is the empty string. **/
+    static TArray< std::string > Strings;
+    static TMap< FString, HAPI_StringHandle > StringHandles;
+};
+
+FCriticalSection
+FHoudiniMockHapi::CriticalSection;
+
+FHoudiniEngineMockApiSettings
+FHoudiniMockHapi::Settings;
+
+bool
+FHoudiniMockHapi::bBound = false;
+
+bool
+FHoudiniMockHapi::bSessionOpen = false;
+
+bool
+FHoudiniMockHapi::bInitialized = false;
+
+TMap< HAPI_NodeId, FHoudiniMockNode >
+FHoudiniMockHapi::Nodes;
+
+HAPI_NodeId
+FHoudiniMockHapi::NextNodeId = 1;
+
+int32
+FHoudiniMockHapi::NextAssetIndex = 1;
+
+HAPI_AssetLibraryId
+FHoudiniMockHapi::NextLibraryId = 1;
+
+TArray< HAPI_NodeId >
+FHoudiniMockHapi::ComposedChildNodes;
+
+TArray< std::string >
+FHoudiniMockHapi::Strings;
+
+TMap< FString, HAPI_StringHandle >
+FHoudiniMockHapi::StringHandles;
+
+/** Lock the mock scene, and fail calls made without a session like libHAPI does. **/
+#define HOUDINI_MOCK_LOCK_SESSION() \
+    FScopeLock ScopeLock( &FHoudiniMockHapi::CriticalSection ); \
+    if ( !FHoudiniMockHapi::bSessionOpen ) \
+        return HAPI_RESULT_INVALID_SESSION;
+
+/** Look up a node of the mock scene, failing the call if it does not exist. **/
+#define HOUDINI_MOCK_FIND_NODE( VarName, NodeId ) \
+    FHoudiniMockNode * VarName = FHoudiniMockHapi::FindNode( NodeId ); \
+    if ( !VarName ) \
+        return HAPI_RESULT_NODE_INVALID;
+
+/** Grid topology of generated mesh parts, two triangles per cell. **/
+static int32
+HoudiniMockGetPointCount( int32 Resolution )
+{
+    return ( Resolution + 1 ) * ( Resolution + 1 );
+}
+
+static int32
+HoudiniMockGetFaceCount( int32 Resolution )
+{
+    return 2 * Resolution * Resolution;
+}
+
+static int32
+HoudiniMockGetVertexPoint( int32 Resolution, int32 VertexIdx )
+{
+    const int32 TriangleIdx = VertexIdx / 3;
+    const int32 Corner = VertexIdx % 3;
+    const int32 CellIdx = TriangleIdx / 2;
+
+    const int32 P00 = ( CellIdx / Resolution ) * ( Resolution + 1 ) + ( CellIdx % Resolution );
+    const int32 P10 = P00 + 1;
+    const int32 P01 = P00 + Resolution + 1;
+    const int32 P11 = P01 + 1;
+
+    if ( TriangleIdx % 2 == 0 )
+        return Corner == 0 ? P00 : ( Corner == 1 ? P01 : P10 );
+
+    return Corner == 0 ? P10 : ( Corner == 1 ? P01 : P11 );
+}
+
+/** Evaluate a generated mesh attribute for one element. **/
+static void
+HoudiniMockEvaluateMeshAttribute(
+    const FString & Name, int32 Resolution, int32 PartIdx, int32 ElementIdx, bool bVertex, float * Value )
+{
+    const int32 PointIdx = bVertex ? HoudiniMockGetVertexPoint( Resolution, ElementIdx ) : ElementIdx;
+    const int32 X = PointIdx % ( Resolution + 1 );
+    const int32 Z = PointIdx / ( Resolution + 1 );
+    const float U = (float) X / (float) Resolution;
+    const float V = (float) Z / (float) Resolution;
+
+    if ( Name == TEXT( HAPI_UNREAL_ATTRIB_POSITION ) )
+    {
+        // Parts of an object are laid out next to each other along Z.
+        const float PartOffset = PartIdx * ( Resolution + 1 ) * HAPI_UNREAL_MOCK_CELL_SIZE;
+        Value[ 0 ] = X * HAPI_UNREAL_MOCK_CELL_SIZE;
+        Value[ 1 ] = 0.05f * FMath::Sin( X * 0.3f + PartIdx ) * FMath::Cos( Z * 0.2f );
+        Value[ 2 ] = Z * HAPI_UNREAL_MOCK_CELL_SIZE + PartOffset;
+    }
+    else if ( Name == TEXT( HAPI_UNREAL_ATTRIB_COLOR ) )
+    {
+        Value[ 0 ] = U;
+        Value[ 1 ] = V;
+        Value[ 2 ] = 0.5f;
+    }
+    else if ( Name == TEXT( HAPI_UNREAL_ATTRIB_NORMAL ) )
+    {
+        Value[ 0 ] = 0.0f;
+        Value[ 1 ] = 1.0f;
+        Value[ 2 ] = 0.0f;
+    }
+    else
+    {
+        Value[ 0 ] = U;
+        Value[ 1 ] = V;
+        Value[ 2 ] = 0.0f;
+    }
+}
+
+/** Evaluate a generated heightfield layer at the given voxel. **/
+static float
+HoudiniMockEvaluateHeightfield( int32 LayerIdx, int32 X, int32 Y )
+{
+    if ( LayerIdx == 0 )
+        return 10.0f * FMath::Sin( X * 0.05f ) * FMath::Cos( Y * 0.07f ) + 2.0f * FMath::Sin( X * 0.31f + Y * 0.17f );
+
+    return 0.5f + 0.5f * FMath::Sin( X * 0.1f * LayerIdx ) * FMath::Cos( Y * 0.1f );
+}
+
+void
+FHoudiniMockHapi::RoundTrip( int64 PayloadBytes )
+{
+    double Seconds = Settings.CallLatencyMicroseconds * 1e-6;
+    if ( Settings.BandwidthMegabytesPerSecond > 0.0f && PayloadBytes > 0 )
+        Seconds += (double) PayloadBytes / ( Settings.BandwidthMegabytesPerSecond * 1024.0 * 1024.0 );
+
+    if ( Seconds <= 0.0 )
+        return;
+
+    // Sleeping is too coarse for sub millisecond latencies, spin instead.
+    if ( Seconds >= 0.001 )
+    {
+        FPlatformProcess::Sleep( (float) Seconds );
+        return;
+    }
+
+    const double EndTime = FPlatformTime::Seconds() + Seconds;
+    while ( FPlatformTime::Seconds() < EndTime )
+        FPlatformProcess::Sleep( 0.0f );
+}
+
+HAPI_StringHandle
+FHoudiniMockHapi::Intern( const FString & String )
+{
+    if ( String.IsEmpty() )
+        return 0;
+
+    if ( const HAPI_StringHandle * FoundHandle = StringHandles.Find( String ) )
+        return *FoundHandle;
+
+    const HAPI_StringHandle Handle = Strings.Add( std::string( TCHAR_TO_UTF8( *String ) ) );
+    StringHandles.Add( String, Handle );
+    return Handle;
+}
+
+FHoudiniMockNode *
+FHoudiniMockHapi::FindNode( HAPI_NodeId NodeId )
+{
+    return Nodes.Find( NodeId );
+}
+
+HAPI_NodeId
+FHoudiniMockHapi::AddNode( EHoudiniMockNodeKind Kind, HAPI_NodeType Type, HAPI_NodeId ParentId, const FString & Name )
+{
+    FHoudiniMockNode Node;
+    Node.Kind = Kind;
+    Node.Type = Type;
+    Node.Id = NextNodeId++;
+    Node.ParentId = ParentId;
+    Node.Name = Name;
+
+    FHoudiniMockNode * ParentNode = FindNode( ParentId );
+    Node.Path = ( ParentNode ? ParentNode->Path : FString( TEXT( "/obj" ) ) ) + TEXT( "/" ) + Name;
+    if ( ParentNode )
+    {
+        ParentNode->Children.Add( Node.Id );
+        Node.AssetId = ParentNode->AssetId;
+    }
+
+    const HAPI_NodeId NodeId = Node.Id;
+    Nodes.Add( NodeId, Node );
+    return NodeId;
+}
+
+void
+FHoudiniMockHapi::RemoveNode( HAPI_NodeId NodeId )
+{
+    FHoudiniMockNode Node;
+    if ( !Nodes.RemoveAndCopyValue( NodeId, Node ) )
+        return;
+
+    if ( FHoudiniMockNode * ParentNode = FindNode( Node.ParentId ) )
+        ParentNode->Children.Remove( NodeId );
+
+    for ( HAPI_NodeId ChildId : Node.Children )
+        RemoveNode( ChildId );
+
+    for ( HAPI_NodeId MaterialId : Node.Materials )
+        RemoveNode( MaterialId );
+}
+
+HAPI_NodeId
+FHoudiniMockHapi::CreateAsset( const FString & Name )
+{
+    const HAPI_NodeId AssetId = AddNode( EHoudiniMockNodeKind::Asset, HAPI_NODETYPE_OBJ, -1, Name );
+    Nodes[ AssetId ].AssetId = AssetId;
+
+    const int32 ObjectCount =
+        Settings.MeshObjectCount + ( Settings.HeightfieldSize > 0 ? 1 : 0 ) + Settings.InstancerCount;
+
+    for ( int32 ObjectIdx = 0; ObjectIdx < ObjectCount; ++ObjectIdx )
+    {
+        const HAPI_NodeId ObjectId = AddNode(
+            EHoudiniMockNodeKind::Object, HAPI_NODETYPE_OBJ, AssetId, FString::Printf( TEXT( "object%d" ), ObjectIdx ) );
+        Nodes[ ObjectId ].Index = ObjectIdx;
+
+        const HAPI_NodeId GeoId = AddNode( EHoudiniMockNodeKind::Geo, HAPI_NODETYPE_SOP, ObjectId, TEXT( "display" ) );
+        Nodes[ GeoId ].Index = ObjectIdx;
+    }
+
+    for ( int32 MaterialIdx = 0; MaterialIdx < Settings.MaterialCount; ++MaterialIdx )
+    {
+        // Materials are not children, they are not returned when composing the asset's objects.
+        const HAPI_NodeId MaterialId = AddNode(
+            EHoudiniMockNodeKind::Material, HAPI_NODETYPE_SHOP, AssetId, FString::Printf( TEXT( "material%d" ), MaterialIdx ) );
+
+        FHoudiniMockNode & AssetNode = Nodes[ AssetId ];
+        AssetNode.Children.Remove( MaterialId );
+        AssetNode.Materials.Add( MaterialId );
+        Nodes[ MaterialId ].Index = MaterialIdx;
+    }
+
+    return AssetId;
+}
+
+bool
+FHoudiniMockHapi::IsDirty( const FHoudiniMockNode & Node )
+{
+    const FHoudiniMockNode * AssetNode = FindNode( Node.AssetId );
+    return Settings.bDirtyOnEveryCook || !AssetNode || AssetNode->CookCount <= 1;
+}
+
+EHoudiniMockObjectKind
+FHoudiniMockHapi::GetObjectKind( int32 ObjectIndex )
+{
+    if ( ObjectIndex < Settings.MeshObjectCount )
+        return EHoudiniMockObjectKind::Mesh;
+
+    if ( ObjectIndex == Settings.MeshObjectCount && Settings.HeightfieldSize > 0 )
+        return EHoudiniMockObjectKind::Heightfield;
+
+    return EHoudiniMockObjectKind::Instancer;
+}
+
+int32
+FHoudiniMockHapi::GetPartCount( const FHoudiniMockNode & Geo )
+{
+    if ( Geo.Kind != EHoudiniMockNodeKind::Geo )
+        return Geo.UploadedParts.Num();
+
+    switch ( GetObjectKind( Geo.Index ) )
+    {
+        case EHoudiniMockObjectKind::Mesh:          return Settings.MeshPartsPerObject;
+        case EHoudiniMockObjectKind::Heightfield:   return 1 + Settings.HeightfieldLayerCount;
+        default:                                    return 2;
+    }
+}
+
+int32
+FHoudiniMockHapi::GetPartResolution( const FHoudiniMockNode & Geo, HAPI_PartId PartId )
+{
+    if ( Geo.Kind != EHoudiniMockNodeKind::Geo || PartId < 0 || PartId >= GetPartCount( Geo ) )
+        return 0;
+
+    switch ( GetObjectKind( Geo.Index ) )
+    {
+        // Instancers instance a single quad, their part 1 is the instancer itself.
+        case EHoudiniMockObjectKind::Mesh:          return Settings.MeshResolution;
+        case EHoudiniMockObjectKind::Instancer:     return PartId == 0 ? 1 : 0;
+        default:                                    return 0;
+    }
+}
+
+bool
+FHoudiniMockHapi::GetPartInfo( const FHoudiniMockNode & Geo, HAPI_PartId PartId, HAPI_PartInfo & PartInfo )
+{
+    FMemory::Memzero< HAPI_PartInfo >( PartInfo );
+
+    if ( Geo.Kind != EHoudiniMockNodeKind::Geo )
+    {
+        const HAPI_PartInfo * UploadedPartInfo = Geo.UploadedParts.Find( PartId );
+        if ( !UploadedPartInfo )
+            return false;
+
+        PartInfo = *UploadedPartInfo;
+        PartInfo.id = PartId;
+        return true;
+    }
+
+    if ( PartId < 0 || PartId >= GetPartCount( Geo ) )
+        return false;
+
+    PartInfo.id = PartId;
+
+    const int32 Resolution = GetPartResolution( Geo, PartId );
+    if ( Resolution > 0 )
+    {
+        PartInfo.nameSH = Intern( FString::Printf( TEXT( "part%d" ), PartId ) );
+        PartInfo.type = HAPI_PARTTYPE_MESH;
+        PartInfo.faceCount = HoudiniMockGetFaceCount( Resolution );
+        PartInfo.vertexCount = PartInfo.faceCount * 3;
+        PartInfo.pointCount = HoudiniMockGetPointCount( Resolution );
+        PartInfo.attributeCounts[ HAPI_ATTROWNER_POINT ] = 2;
+        PartInfo.attributeCounts[ HAPI_ATTROWNER_VERTEX ] = 2;
+        PartInfo.isInstanced = GetObjectKind( Geo.Index ) == EHoudiniMockObjectKind::Instancer;
+    }
+    else if ( GetObjectKind( Geo.Index ) == EHoudiniMockObjectKind::Heightfield )
+    {
+        PartInfo.nameSH = Intern( PartId == 0 ? FString( TEXT( "height" ) ) : FString::Printf( TEXT( "layer%d" ), PartId ) );
+        PartInfo.type = HAPI_PARTTYPE_VOLUME;
+        PartInfo.faceCount = 1;
+        PartInfo.vertexCount = 1;
+        PartInfo.pointCount = 1;
+    }
+    else
+    {
+        PartInfo.nameSH = Intern( TEXT( "instancer" ) );
+        PartInfo.type = HAPI_PARTTYPE_INSTANCER;
+        PartInfo.pointCount = Settings.InstancesPerInstancer;
+        PartInfo.attributeCounts[ HAPI_ATTROWNER_POINT ] = 1;
+        PartInfo.instancedPartCount = 1;
+        PartInfo.instanceCount = Settings.InstancesPerInstancer;
+    }
+
+    return true;
+}
+
+void
+FHoudiniMockHapi::GetPartAttributeNames(
+    const FHoudiniMockNode & Geo, HAPI_PartId PartId, HAPI_AttributeOwner Owner, TArray< FString > & Names )
+{
+    Names.Empty();
+
+    HAPI_PartInfo PartInfo;
+    if ( Geo.Kind != EHoudiniMockNodeKind::Geo || !GetPartInfo( Geo, PartId, PartInfo ) )
+        return;
+
+    if ( PartInfo.type == HAPI_PARTTYPE_MESH )
+    {
+        if ( Owner == HAPI_ATTROWNER_POINT )
+        {
+            Names.Add( TEXT( HAPI_UNREAL_ATTRIB_POSITION ) );
+            Names.Add( TEXT( HAPI_UNREAL_ATTRIB_COLOR ) );
+        }
+        else if ( Owner == HAPI_ATTROWNER_VERTEX )
+        {
+            Names.Add( TEXT( HAPI_UNREAL_ATTRIB_NORMAL ) );
+            Names.Add( TEXT( HAPI_UNREAL_ATTRIB_UV ) );
+        }
+    }
+    else if ( PartInfo.type == HAPI_PARTTYPE_INSTANCER && Owner == HAPI_ATTROWNER_POINT )
+    {
+        Names.Add( TEXT( HAPI_UNREAL_ATTRIB_POSITION ) );
+    }
+}
+
+bool
+FHoudiniMockHapi::GetPartAttributeInfo(
+    const FHoudiniMockNode & Geo, HAPI_PartId PartId, const char * Name, HAPI_AttributeOwner Owner,
+    HAPI_AttributeInfo & AttributeInfo )
+{
+    FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
+    AttributeInfo.owner = HAPI_ATTROWNER_INVALID;
+    AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+    AttributeInfo.storage = HAPI_STORAGETYPE_INVALID;
+
+    HAPI_PartInfo PartInfo;
+    if ( !Name || !GetPartInfo( Geo, PartId, PartInfo ) )
+        return false;
+
+    const FString AttributeName = UTF8_TO_TCHAR( Name );
+    for ( int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx )
+    {
+        // An invalid owner looks the attribute up on every owner.
+        if ( Owner != HAPI_ATTROWNER_INVALID && Owner != OwnerIdx )
+            continue;
+
+        TArray< FString > Names;
+        GetPartAttributeNames( Geo, PartId, (HAPI_AttributeOwner) OwnerIdx, Names );
+        if ( !Names.Contains( AttributeName ) )
+            continue;
+
+        AttributeInfo.exists = true;
+        AttributeInfo.owner = (HAPI_AttributeOwner) OwnerIdx;
+        AttributeInfo.originalOwner = AttributeInfo.owner;
+        AttributeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+        AttributeInfo.count = OwnerIdx == HAPI_ATTROWNER_VERTEX ? PartInfo.vertexCount : PartInfo.pointCount;
+        AttributeInfo.tupleSize = 3;
+        AttributeInfo.typeInfo = HAPI_ATTRIBUTE_TYPE_NONE;
+        break;
+    }
+
+    return true;
+}
+
+void
+FHoudiniMockHapi::GetObjectTransform( const FHoudiniMockNode & Node, HAPI_Transform & Transform )
+{
+    FMemory::Memzero< HAPI_Transform >( Transform );
+    Transform.rotationQuaternion[ 3 ] = 1.0f;
+    Transform.scale[ 0 ] = 1.0f;
+    Transform.scale[ 1 ] = 1.0f;
+    Transform.scale[ 2 ] = 1.0f;
+    Transform.rstOrder = HAPI_SRT;
+
+    // Objects are laid out along X so that their content does not overlap.
+    if ( Node.Kind == EHoudiniMockNodeKind::Object )
+    {
+        const float MeshExtent = ( Settings.MeshResolution + 1 ) * HAPI_UNREAL_MOCK_CELL_SIZE;
+        const float HeightfieldExtent = Settings.HeightfieldSize * HAPI_UNREAL_MOCK_VOXEL_SIZE;
+        Transform.position[ 0 ] = Node.Index * ( FMath::Max( MeshExtent, HeightfieldExtent ) + 1.0f );
+    }
+}
+
+void
+FHoudiniMockHapi::GetInstanceTransform( int32 InstanceIdx, HAPI_Transform & Transform )
+{
+    FMemory::Memzero< HAPI_Transform >( Transform );
+
+    const int32 GridSize = FMath::Max( FMath::CeilToInt( FMath::Sqrt( (float) Settings.InstancesPerInstancer ) ), 1 );
+    const float Angle = InstanceIdx * 0.37f;
+    const float Scale = 1.0f + 0.25f * FMath::Sin( (float) InstanceIdx );
+
+    Transform.position[ 0 ] = ( InstanceIdx % GridSize ) * 0.5f;
+    Transform.position[ 2 ] = ( InstanceIdx / GridSize ) * 0.5f;
+    Transform.rotationQuaternion[ 1 ] = FMath::Sin( Angle * 0.5f );
+    Transform.rotationQuaternion[ 3 ] = FMath::Cos( Angle * 0.5f );
+    Transform.scale[ 0 ] = Scale;
+    Transform.scale[ 1 ] = Scale;
+    Transform.scale[ 2 ] = Scale;
+    Transform.rstOrder = HAPI_SRT;
+}
+
+void
+FHoudiniMockHapi::FillGeoInfo( const FHoudiniMockNode & Geo, HAPI_GeoInfo & GeoInfo )
+{
+    FMemory::Memzero< HAPI_GeoInfo >( GeoInfo );
+    GeoInfo.type = Geo.Kind == EHoudiniMockNodeKind::Geo ? HAPI_GEOTYPE_DEFAULT : HAPI_GEOTYPE_INPUT;
+    GeoInfo.nameSH = Intern( Geo.Name );
+    GeoInfo.nodeId = Geo.Id;
+    GeoInfo.isDisplayGeo = true;
+    GeoInfo.hasGeoChanged = IsDirty( Geo );
+    GeoInfo.hasMaterialChanged = GeoInfo.hasGeoChanged;
+    GeoInfo.partCount = GetPartCount( Geo );
+}
+
+void
+FHoudiniMockHapi::FillObjectInfo( const FHoudiniMockNode & Object, HAPI_ObjectInfo & ObjectInfo )
+{
+    FMemory::Memzero< HAPI_ObjectInfo >( ObjectInfo );
+    ObjectInfo.nameSH = Intern( Object.Name );
+    ObjectInfo.objectInstancePathSH = Intern( Object.Path );
+    ObjectInfo.hasTransformChanged = IsDirty( Object );
+    ObjectInfo.haveGeosChanged = ObjectInfo.hasTransformChanged;
+    ObjectInfo.isVisible = true;
+    ObjectInfo.geoCount = Object.Children.Num();
+    ObjectInfo.nodeId = Object.Id;
+    ObjectInfo.objectToInstanceId = -1;
+}
+
+int32
+FHoudiniMockHapi::GetParmCount( const FHoudiniMockNode & Node )
+{
+    // Materials expose a diffuse color and, if textures are enabled, a diffuse texture.
+    if ( Node.Kind != EHoudiniMockNodeKind::Material )
+        return 0;
+
+    return Settings.TextureResolution > 0 ? 2 : 1;
+}
+
+bool
+FHoudiniMockHapi::FillParmInfo( const FHoudiniMockNode & Node, HAPI_ParmId ParmId, HAPI_ParmInfo & ParmInfo )
+{
+    FMemory::Memzero< HAPI_ParmInfo >( ParmInfo );
+    if ( ParmId < 0 || ParmId >= GetParmCount( Node ) )
+        return false;
+
+    ParmInfo.id = ParmId;
+    ParmInfo.parentId = -1;
+    ParmInfo.childIndex = ParmId;
+    ParmInfo.intValuesIndex = -1;
+    ParmInfo.floatValuesIndex = -1;
+    ParmInfo.stringValuesIndex = -1;
+    ParmInfo.choiceIndex = -1;
+    ParmInfo.inputNodeType = HAPI_NODETYPE_ANY;
+    ParmInfo.instanceNum = -1;
+
+    if ( ParmId == 0 )
+    {
+        ParmInfo.type = HAPI_PARMTYPE_COLOR;
+        ParmInfo.size = 3;
+        ParmInfo.floatValuesIndex = 0;
+        ParmInfo.nameSH = Intern( TEXT( HAPI_UNREAL_PARAM_COLOR_DIFFUSE_0 ) );
+    }
+    else
+    {
+        ParmInfo.type = HAPI_PARMTYPE_PATH_FILE_IMAGE;
+        ParmInfo.size = 1;
+        ParmInfo.stringValuesIndex = 0;
+        ParmInfo.nameSH = Intern( TEXT( HAPI_UNREAL_PARAM_MAP_DIFFUSE_0 ) );
+    }
+
+    ParmInfo.labelSH = ParmInfo.nameSH;
+    return true;
+}
+
+HAPI_Result
+FHoudiniMockHapi::CreateInProcessSession( HAPI_Session * session )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+    if ( !session )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    session->type = HAPI_SESSION_INPROCESS;
+    session->id = 0;
+    bSessionOpen = true;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::CreateThriftSocketSession( HAPI_Session * session, const char * host_name, int port )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+    if ( !session )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    session->type = HAPI_SESSION_THRIFT;
+    session->id = 1;
+    bSessionOpen = true;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::CreateThriftNamedPipeSession( HAPI_Session * session, const char * pipe_name )
+{
+    return CreateThriftSocketSession( session, nullptr, 0 );
+}
+
+HAPI_Result
+FHoudiniMockHapi::StartThriftSocketServer( const HAPI_ThriftServerOptions * options, int port, HAPI_ProcessId * process_id )
+{
+    if ( process_id )
+        *process_id = 0;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::StartThriftNamedPipeServer(
+    const HAPI_ThriftServerOptions * options, const char * pipe_name, HAPI_ProcessId * process_id )
+{
+    return StartThriftSocketServer( options, 0, process_id );
+}
+
+HAPI_Result
+FHoudiniMockHapi::IsSessionValid( const HAPI_Session * session )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+    return ( session && bSessionOpen ) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_SESSION;
+}
+
+HAPI_Result
+FHoudiniMockHapi::CloseSession( const HAPI_Session * session )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+    bSessionOpen = false;
+    bInitialized = false;
+    Nodes.Empty();
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::Initialize(
+    const HAPI_Session * session, const HAPI_CookOptions * cook_options, HAPI_Bool use_cooking_thread,
+    int cooking_thread_stack_size, const char * houdini_environment_files, const char * otl_search_path,
+    const char * dso_search_path, const char * image_dso_search_path, const char * audio_dso_search_path )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( bInitialized )
+        return HAPI_RESULT_ALREADY_INITIALIZED;
+
+    bInitialized = true;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::IsInitialized( const HAPI_Session * session )
+{
+    HOUDINI_MOCK_LOCK_SESSION();
+    return bInitialized ? HAPI_RESULT_SUCCESS : HAPI_RESULT_NOT_INITIALIZED;
+}
+
+HAPI_Result
+FHoudiniMockHapi::Cleanup( const HAPI_Session * session )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    bInitialized = false;
+    Nodes.Empty();
+    ComposedChildNodes.Empty();
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetEnvInt( HAPI_EnvIntType int_type, int * value )
+{
+    if ( !value )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    switch ( int_type )
+    {
+        case HAPI_ENVINT_VERSION_HOUDINI_MAJOR:         *value = HAPI_VERSION_HOUDINI_MAJOR; break;
+        case HAPI_ENVINT_VERSION_HOUDINI_MINOR:         *value = HAPI_VERSION_HOUDINI_MINOR; break;
+        case HAPI_ENVINT_VERSION_HOUDINI_BUILD:         *value = HAPI_VERSION_HOUDINI_BUILD; break;
+        case HAPI_ENVINT_VERSION_HOUDINI_PATCH:         *value = HAPI_VERSION_HOUDINI_PATCH; break;
+        case HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MAJOR:  *value = HAPI_VERSION_HOUDINI_ENGINE_MAJOR; break;
+        case HAPI_ENVINT_VERSION_HOUDINI_ENGINE_MINOR:  *value = HAPI_VERSION_HOUDINI_ENGINE_MINOR; break;
+        case HAPI_ENVINT_VERSION_HOUDINI_ENGINE_API:    *value = HAPI_VERSION_HOUDINI_ENGINE_API; break;
+        default:                                        *value = 0; break;
+    }
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetSessionEnvInt( const HAPI_Session * session, HAPI_SessionEnvIntType int_type, int * value )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !value )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *value = int_type == HAPI_SESSIONENVINT_LICENSE ? (int) HAPI_LICENSE_HOUDINI_ENGINE : 0;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetServerEnvString( const HAPI_Session * session, const char * variable_name, const char * value )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetTime( const HAPI_Session * session, float time )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetStatus( const HAPI_Session * session, HAPI_StatusType status_type, int * status )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !status )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    // Cooks are synchronous, so there is never a cook in progress.
+    *status = status_type == HAPI_STATUS_COOK_STATE ? (int) HAPI_STATE_READY : (int) HAPI_RESULT_SUCCESS;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetStatusStringBufLength(
+    const HAPI_Session * session, HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity, int * buffer_length )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !buffer_length )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *buffer_length = 1;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetStatusString( const HAPI_Session * session, HAPI_StatusType status_type, char * string_value, int length )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !string_value || length < 1 )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    string_value[ 0 ] = '\0';
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetStringBufLength( const HAPI_Session * session, HAPI_StringHandle string_handle, int * buffer_length )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !buffer_length || !Strings.IsValidIndex( string_handle ) )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *buffer_length = (int) Strings[ string_handle ].size() + 1;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetString( const HAPI_Session * session, HAPI_StringHandle string_handle, char * string_value, int length )
+{
+    RoundTrip( length );
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !string_value || length < 1 || !Strings.IsValidIndex( string_handle ) )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    const std::string & String = Strings[ string_handle ];
+    const int32 CopyLength = FMath::Min( (int32) String.size(), length - 1 );
+    FMemory::Memcpy( string_value, String.c_str(), CopyLength );
+    string_value[ CopyLength ] = '\0';
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::LoadAssetLibraryFromFile(
+    const HAPI_Session * session, const char * file_path, HAPI_Bool allow_overwrite, HAPI_AssetLibraryId * library_id )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !library_id )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *library_id = NextLibraryId++;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::LoadAssetLibraryFromMemory(
+    const HAPI_Session * session, const char * library_buffer, int library_buffer_length, HAPI_Bool allow_overwrite,
+    HAPI_AssetLibraryId * library_id )
+{
+    RoundTrip( library_buffer_length );
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !library_id )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *library_id = NextLibraryId++;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetAvailableAssetCount( const HAPI_Session * session, HAPI_AssetLibraryId library_id, int * asset_count )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !asset_count )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *asset_count = 1;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetAvailableAssets(
+    const HAPI_Session * session, HAPI_AssetLibraryId library_id, HAPI_StringHandle * asset_names_array, int asset_count )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !asset_names_array || asset_count != 1 )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    asset_names_array[ 0 ] = Intern( TEXT( HAPI_UNREAL_MOCK_ASSET_NAME ) );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::CreateNode(
+    const HAPI_Session * session, HAPI_NodeId parent_node_id, const char * operator_name, const char * node_label,
+    HAPI_Bool cook_on_creation, HAPI_NodeId * new_node_id )
+{
+    RoundTrip();
+
+    {
+        HOUDINI_MOCK_LOCK_SESSION();
+
+        if ( !operator_name || !new_node_id )
+            return HAPI_RESULT_INVALID_ARGUMENT;
+
+        if ( parent_node_id >= 0 && !FindNode( parent_node_id ) )
+            return HAPI_RESULT_NODE_INVALID;
+
+        const FString OperatorName = UTF8_TO_TCHAR( operator_name );
+        FString NodeName = node_label ? FString( UTF8_TO_TCHAR( node_label ) ) : FString( TEXT( "" ) );
+        if ( NodeName.IsEmpty() )
+        {
+            OperatorName.Split( TEXT( "/" ), nullptr, &NodeName, ESearchCase::IgnoreCase, ESearchDir::FromEnd );
+            NodeName = FString::Printf( TEXT( "%s%d" ), NodeName.IsEmpty() ? TEXT( "node" ) : *NodeName, NextNodeId );
+        }
+
+        if ( OperatorName == TEXT( HAPI_UNREAL_MOCK_ASSET_NAME ) )
+        {
+            *new_node_id = CreateAsset( FString::Printf( TEXT( "houdini_mock_scene%d" ), NextAssetIndex++ ) );
+        }
+        else if ( OperatorName.StartsWith( TEXT( "SOP/" ) ) || OperatorName.StartsWith( TEXT( "Sop/" ) ) )
+        {
+            // SOP nodes created at the root are wrapped in their own OBJ node, like libHAPI does.
+            HAPI_NodeId ParentId = parent_node_id;
+            if ( ParentId < 0 )
+                ParentId = AddNode( EHoudiniMockNodeKind::Generic, HAPI_NODETYPE_OBJ, -1, NodeName );
+
+            *new_node_id = AddNode( EHoudiniMockNodeKind::Generic, HAPI_NODETYPE_SOP, ParentId, NodeName );
+        }
+        else
+        {
+            *new_node_id = AddNode( EHoudiniMockNodeKind::Generic, HAPI_NODETYPE_OBJ, parent_node_id, NodeName );
+        }
+
+        if ( !cook_on_creation )
+            return HAPI_RESULT_SUCCESS;
+    }
+
+    return CookNode( session, *new_node_id, nullptr );
+}
+
+HAPI_Result
+FHoudiniMockHapi::CreateInputNode( const HAPI_Session * session, HAPI_NodeId * node_id, const char * name )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !node_id )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    FString NodeName = name ? FString( UTF8_TO_TCHAR( name ) ) : FString( TEXT( "" ) );
+    if ( NodeName.IsEmpty() )
+        NodeName = FString::Printf( TEXT( "input%d" ), NextNodeId );
+
+    const HAPI_NodeId ObjectId = AddNode( EHoudiniMockNodeKind::Generic, HAPI_NODETYPE_OBJ, -1, NodeName );
+    *node_id = AddNode( EHoudiniMockNodeKind::Generic, HAPI_NODETYPE_SOP, ObjectId, TEXT( "input_node" ) );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::DeleteNode( const HAPI_Session * session, HAPI_NodeId node_id )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    RemoveNode( node_id );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::CookNode( const HAPI_Session * session, HAPI_NodeId node_id, const HAPI_CookOptions * cook_options )
+{
+    RoundTrip();
+
+    bool bIsAsset = false;
+    {
+        HOUDINI_MOCK_LOCK_SESSION();
+        HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+        Node->CookCount++;
+        bIsAsset = Node->Kind == EHoudiniMockNodeKind::Asset;
+    }
+
+    // Generated content is evaluated lazily, the cook only costs the configured time.
+    if ( bIsAsset && Settings.CookMilliseconds > 0.0f )
+        FPlatformProcess::Sleep( Settings.CookMilliseconds * 0.001f );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetNodeInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeInfo * node_info )
+{
+    RoundTrip( sizeof( HAPI_NodeInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !node_info )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    const FHoudiniMockNode * AssetNode = FindNode( Node->AssetId );
+
+    FMemory::Memzero< HAPI_NodeInfo >( *node_info );
+    node_info->id = Node->Id;
+    node_info->parentId = Node->ParentId;
+    node_info->nameSH = Intern( Node->Name );
+    node_info->type = Node->Type;
+    node_info->isValid = true;
+    node_info->totalCookCount = AssetNode ? AssetNode->CookCount : Node->CookCount;
+    node_info->uniqueHoudiniNodeId = Node->Id;
+    node_info->internalNodePathSH = Intern( Node->Path );
+    node_info->parmCount = GetParmCount( *Node );
+    node_info->parmFloatValueCount = node_info->parmCount > 0 ? 3 : 0;
+    node_info->parmStringValueCount = node_info->parmCount > 1 ? 1 : 0;
+    node_info->childNodeCount = Node->Children.Num();
+    node_info->inputCount = Node->Kind == EHoudiniMockNodeKind::Generic ? 4 : 0;
+    node_info->createdPostAssetLoad = Node->Kind == EHoudiniMockNodeKind::Generic;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::IsNodeValid( const HAPI_Session * session, HAPI_NodeId node_id, int unique_node_id, HAPI_Bool * answer )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !answer )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *answer = FindNode( node_id ) != nullptr && node_id == unique_node_id;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetNodePath(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeId relative_to_node_id, HAPI_StringHandle * path )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !path )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    FString NodePath = Node->Path;
+    if ( const FHoudiniMockNode * RelativeNode = FindNode( relative_to_node_id ) )
+    {
+        if ( NodePath.StartsWith( RelativeNode->Path + TEXT( "/" ) ) )
+            NodePath = NodePath.Mid( RelativeNode->Path.Len() + 1 );
+    }
+
+    *path = Intern( NodePath );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::ComposeChildNodeList(
+    const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_NodeTypeBits node_type_filter,
+    HAPI_NodeFlagsBits node_flags_filter, HAPI_Bool recursive, int * count )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, parent_node_id );
+
+    if ( !count )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    ComposedChildNodes.Empty();
+
+    // Generated geos are never editable or templated, only plain type filters can match.
+    if ( node_flags_filter == HAPI_NODEFLAGS_ANY || node_flags_filter == HAPI_NODEFLAGS_NONE )
+    {
+        TArray< HAPI_NodeId > PendingNodes = Node->Children;
+        while ( PendingNodes.Num() > 0 )
+        {
+            const FHoudiniMockNode * ChildNode = FindNode( PendingNodes.Pop( false ) );
+            if ( !ChildNode )
+                continue;
+
+            if ( node_type_filter == HAPI_NODETYPE_ANY || ( node_type_filter & ChildNode->Type ) )
+                ComposedChildNodes.Add( ChildNode->Id );
+
+            if ( recursive )
+                PendingNodes.Append( ChildNode->Children );
+        }
+    }
+
+    *count = ComposedChildNodes.Num();
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetComposedChildNodeList(
+    const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_NodeId * child_node_ids_array, int count )
+{
+    RoundTrip( count * sizeof( HAPI_NodeId ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+
+    if ( !child_node_ids_array || count != ComposedChildNodes.Num() )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    FMemory::Memcpy( child_node_ids_array, ComposedChildNodes.GetData(), count * sizeof( HAPI_NodeId ) );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::ConnectNodeInput( const HAPI_Session * session, HAPI_NodeId node_id, int input_index, HAPI_NodeId node_id_to_connect )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !FindNode( node_id_to_connect ) )
+        return HAPI_RESULT_NODE_INVALID;
+
+    Node->Inputs.Add( input_index, node_id_to_connect );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::DisconnectNodeInput( const HAPI_Session * session, HAPI_NodeId node_id, int input_index )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    Node->Inputs.Remove( input_index );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::QueryNodeInput(
+    const HAPI_Session * session, HAPI_NodeId node_to_query, int input_index, HAPI_NodeId * connected_node_id )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_to_query );
+
+    if ( !connected_node_id )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    const HAPI_NodeId * ConnectedNodeId = Node->Inputs.Find( input_index );
+    *connected_node_id = ConnectedNodeId ? *ConnectedNodeId : -1;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetAssetInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_AssetInfo * asset_info )
+{
+    RoundTrip( sizeof( HAPI_AssetInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !asset_info )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    FMemory::Memzero< HAPI_AssetInfo >( *asset_info );
+    asset_info->nodeId = Node->Id;
+    asset_info->objectNodeId = Node->Type == HAPI_NODETYPE_SOP ? Node->ParentId : Node->Id;
+    asset_info->hasEverCooked = Node->CookCount > 0;
+    asset_info->nameSH = Intern( Node->Name );
+    asset_info->labelSH = asset_info->nameSH;
+
+    if ( Node->Kind == EHoudiniMockNodeKind::Asset )
+    {
+        asset_info->filePathSH = Intern( TEXT( "houdini_mock_scene.hda" ) );
+        asset_info->fullOpNameSH = Intern( TEXT( HAPI_UNREAL_MOCK_ASSET_NAME ) );
+        asset_info->objectCount = Node->Children.Num();
+        asset_info->haveObjectsChanged = IsDirty( *Node );
+        asset_info->haveMaterialsChanged = asset_info->haveObjectsChanged;
+    }
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetParameters( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmInfo * parm_infos_array, int start, int length )
+{
+    RoundTrip( length * sizeof( HAPI_ParmInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( length < 0 || start < 0 || start + length > GetParmCount( *Node ) || ( length > 0 && !parm_infos_array ) )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    for ( int32 Idx = 0; Idx < length; ++Idx )
+        FillParmInfo( *Node, start + Idx, parm_infos_array[ Idx ] );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetParmInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ParmId parm_id, HAPI_ParmInfo * parm_info )
+{
+    RoundTrip( sizeof( HAPI_ParmInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !parm_info || !FillParmInfo( *Node, parm_id, *parm_info ) )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetParmIdFromName( const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_ParmId * parm_id )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !parm_name || !parm_id )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *parm_id = -1;
+    for ( int32 ParmIdx = 0, ParmCount = GetParmCount( *Node ); ParmIdx < ParmCount; ++ParmIdx )
+    {
+        HAPI_ParmInfo ParmInfo;
+        FillParmInfo( *Node, ParmIdx, ParmInfo );
+        if ( Strings[ ParmInfo.nameSH ] == parm_name )
+        {
+            *parm_id = ParmIdx;
+            break;
+        }
+    }
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetParmWithTag( const HAPI_Session * session, HAPI_NodeId node_id, const char * tag_name, HAPI_ParmId * parm_id )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !parm_id )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    // Generated parameters carry no tags.
+    *parm_id = -1;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetParmFloatValues( const HAPI_Session * session, HAPI_NodeId node_id, float * values_array, int start, int length )
+{
+    RoundTrip( length * sizeof( float ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    const int32 ValueCount = GetParmCount( *Node ) > 0 ? 3 : 0;
+    if ( length < 0 || start < 0 || start + length > ValueCount || ( length > 0 && !values_array ) )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    // Diffuse color, varying per material.
+    for ( int32 Idx = 0; Idx < length; ++Idx )
+        values_array[ Idx ] = FMath::Frac( 0.2f + ( Node->Index + 1 ) * 0.37f * ( start + Idx + 1 ) );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetParmIntValues( const HAPI_Session * session, HAPI_NodeId node_id, int * values_array, int start, int length )
+{
+    RoundTrip( length * sizeof( int ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    return length == 0 ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetParmStringValues(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_Bool evaluate, HAPI_StringHandle * values_array, int start, int length )
+{
+    RoundTrip( length * sizeof( HAPI_StringHandle ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    const int32 ValueCount = GetParmCount( *Node ) > 1 ? 1 : 0;
+    if ( length < 0 || start < 0 || start + length > ValueCount || ( length > 0 && !values_array ) )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    if ( length > 0 )
+        values_array[ 0 ] = Intern( FString::Printf( TEXT( "%s_diffuse.rat" ), *Node->Name ) );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetParmFloatValue( const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, float value )
+{
+    RoundTrip( sizeof( float ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetParmFloatValues( const HAPI_Session * session, HAPI_NodeId node_id, const float * values_array, int start, int length )
+{
+    RoundTrip( length * sizeof( float ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetParmIntValue( const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, int index, int value )
+{
+    RoundTrip( sizeof( int ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetParmIntValues( const HAPI_Session * session, HAPI_NodeId node_id, const int * values_array, int start, int length )
+{
+    RoundTrip( length * sizeof( int ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetParmStringValue( const HAPI_Session * session, HAPI_NodeId node_id, const char * value, HAPI_ParmId parm_id, int index )
+{
+    RoundTrip( value ? FCStringAnsi::Strlen( value ) : 0 );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetParmNodeValue( const HAPI_Session * session, HAPI_NodeId node_id, const char * parm_name, HAPI_NodeId value )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::ComposeObjectList( const HAPI_Session * session, HAPI_NodeId parent_node_id, const char * categories, int * object_count )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, parent_node_id );
+
+    if ( !object_count )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *object_count = Node->Kind == EHoudiniMockNodeKind::Asset ? Node->Children.Num() : 0;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetComposedObjectList(
+    const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_ObjectInfo * object_infos_array, int start, int length )
+{
+    RoundTrip( length * sizeof( HAPI_ObjectInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, parent_node_id );
+
+    if ( Node->Kind != EHoudiniMockNodeKind::Asset || start < 0 || length < 0 || start + length > Node->Children.Num()
+        || ( length > 0 && !object_infos_array ) )
+    {
+        return HAPI_RESULT_INVALID_ARGUMENT;
+    }
+
+    for ( int32 Idx = 0; Idx < length; ++Idx )
+        FillObjectInfo( Nodes[ Node->Children[ start + Idx ] ], object_infos_array[ Idx ] );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetComposedObjectTransforms(
+    const HAPI_Session * session, HAPI_NodeId parent_node_id, HAPI_RSTOrder rst_order, HAPI_Transform * transform_array,
+    int start, int length )
+{
+    RoundTrip( length * sizeof( HAPI_Transform ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, parent_node_id );
+
+    if ( Node->Kind != EHoudiniMockNodeKind::Asset || start < 0 || length < 0 || start + length > Node->Children.Num()
+        || ( length > 0 && !transform_array ) )
+    {
+        return HAPI_RESULT_INVALID_ARGUMENT;
+    }
+
+    for ( int32 Idx = 0; Idx < length; ++Idx )
+        GetObjectTransform( Nodes[ Node->Children[ start + Idx ] ], transform_array[ Idx ] );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetObjectInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_ObjectInfo * object_info )
+{
+    RoundTrip( sizeof( HAPI_ObjectInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !object_info || Node->Type != HAPI_NODETYPE_OBJ )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    FillObjectInfo( *Node, *object_info );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetObjectTransform(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_NodeId relative_to_node_id, HAPI_RSTOrder rst_order,
+    HAPI_Transform * transform )
+{
+    RoundTrip( sizeof( HAPI_Transform ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !transform )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    GetObjectTransform( *Node, *transform );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetObjectTransform( const HAPI_Session * session, HAPI_NodeId node_id, const HAPI_TransformEuler * trans )
+{
+    RoundTrip( sizeof( HAPI_TransformEuler ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetDisplayGeoInfo( const HAPI_Session * session, HAPI_NodeId object_node_id, HAPI_GeoInfo * geo_info )
+{
+    RoundTrip( sizeof( HAPI_GeoInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, object_node_id );
+
+    if ( !geo_info )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    // SOP nodes are their own display geo.
+    const FHoudiniMockNode * GeoNode = Node;
+    if ( Node->Type == HAPI_NODETYPE_OBJ )
+        GeoNode = Node->Children.Num() > 0 ? FindNode( Node->Children[ 0 ] ) : nullptr;
+
+    if ( !GeoNode || GeoNode->Type != HAPI_NODETYPE_SOP )
+        return HAPI_RESULT_FAILURE;
+
+    FillGeoInfo( *GeoNode, *geo_info );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetGeoInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_GeoInfo * geo_info )
+{
+    RoundTrip( sizeof( HAPI_GeoInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !geo_info || Node->Type != HAPI_NODETYPE_SOP )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    FillGeoInfo( *Node, *geo_info );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetPartInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_PartInfo * part_info )
+{
+    RoundTrip( sizeof( HAPI_PartInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !part_info || !GetPartInfo( *Node, part_id, *part_info ) )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetAttributeNames(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_AttributeOwner owner,
+    HAPI_StringHandle * attribute_names_array, int count )
+{
+    RoundTrip( count * sizeof( HAPI_StringHandle ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    TArray< FString > Names;
+    GetPartAttributeNames( *Node, part_id, owner, Names );
+    if ( count != Names.Num() || ( count > 0 && !attribute_names_array ) )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    for ( int32 Idx = 0; Idx < count; ++Idx )
+        attribute_names_array[ Idx ] = Intern( Names[ Idx ] );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetAttributeInfo(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeOwner owner,
+    HAPI_AttributeInfo * attr_info )
+{
+    RoundTrip( sizeof( HAPI_AttributeInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    // Missing attributes are not an error, they are reported through exists.
+    if ( !attr_info || !GetPartAttributeInfo( *Node, part_id, name, owner, *attr_info ) )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetAttributeFloatData(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info,
+    int stride, float * data_array, int start, int length )
+{
+    const int32 TupleSize = attr_info ? FMath::Max( attr_info->tupleSize, 1 ) : 1;
+    RoundTrip( (int64) length * TupleSize * sizeof( float ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    HAPI_AttributeInfo AttributeInfo;
+    if ( !attr_info || !data_array || !GetPartAttributeInfo( *Node, part_id, name, attr_info->owner, AttributeInfo )
+        || !AttributeInfo.exists || start < 0 || length < 0 || start + length > AttributeInfo.count )
+    {
+        return HAPI_RESULT_INVALID_ARGUMENT;
+    }
+
+    if ( stride < 0 )
+        stride = AttributeInfo.tupleSize;
+
+    const FString AttributeName = UTF8_TO_TCHAR( name );
+    const int32 ComponentCount = FMath::Min( AttributeInfo.tupleSize, stride );
+    const int32 Resolution = GetPartResolution( *Node, part_id );
+
+    for ( int32 Idx = 0; Idx < length; ++Idx )
+    {
+        float Value[ 3 ] = { 0.0f, 0.0f, 0.0f };
+        if ( Resolution > 0 )
+        {
+            HoudiniMockEvaluateMeshAttribute(
+                AttributeName, Resolution, part_id, start + Idx, AttributeInfo.owner == HAPI_ATTROWNER_VERTEX, Value );
+        }
+        else
+        {
+            // Instancer points.
+            HAPI_Transform Transform;
+            GetInstanceTransform( start + Idx, Transform );
+            FMemory::Memcpy( Value, Transform.position, sizeof( Value ) );
+        }
+
+        for ( int32 Component = 0; Component < ComponentCount; ++Component )
+            data_array[ Idx * stride + Component ] = Value[ Component ];
+    }
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetAttributeIntData(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info,
+    int stride, int * data_array, int start, int length )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    // All generated attributes are float attributes.
+    return HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetAttributeStringData(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info,
+    HAPI_StringHandle * data_array, int start, int length )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    // All generated attributes are float attributes.
+    return HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetVertexList(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * vertex_list_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( int ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    const int32 Resolution = GetPartResolution( *Node, part_id );
+    if ( Resolution <= 0 || !vertex_list_array || start < 0 || length < 0
+        || start + length > HoudiniMockGetFaceCount( Resolution ) * 3 )
+    {
+        return HAPI_RESULT_INVALID_ARGUMENT;
+    }
+
+    for ( int32 Idx = 0; Idx < length; ++Idx )
+        vertex_list_array[ Idx ] = HoudiniMockGetVertexPoint( Resolution, start + Idx );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetFaceCounts(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * face_counts_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( int ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    const int32 Resolution = GetPartResolution( *Node, part_id );
+    if ( Resolution <= 0 || !face_counts_array || start < 0 || length < 0 || start + length > HoudiniMockGetFaceCount( Resolution ) )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    for ( int32 Idx = 0; Idx < length; ++Idx )
+        face_counts_array[ Idx ] = 3;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetGroupNames(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_GroupType group_type, HAPI_StringHandle * group_names_array, int group_count )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    // Generated geos have no groups.
+    return group_count == 0 ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetGroupCountOnPackedInstancePart(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * pointGroupCount, int * primitiveGroupCount )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !pointGroupCount || !primitiveGroupCount )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *pointGroupCount = 0;
+    *primitiveGroupCount = 0;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetMaterialNodeIdsOnFaces(
+    const HAPI_Session * session, HAPI_NodeId geometry_node_id, HAPI_PartId part_id, HAPI_Bool * are_all_the_same,
+    HAPI_NodeId * material_ids_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( HAPI_NodeId ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, geometry_node_id );
+
+    HAPI_PartInfo PartInfo;
+    if ( !are_all_the_same || !GetPartInfo( *Node, part_id, PartInfo ) || start < 0 || length < 0
+        || start + length > PartInfo.faceCount || ( length > 0 && !material_ids_array ) )
+    {
+        return HAPI_RESULT_INVALID_ARGUMENT;
+    }
+
+    // Materials are assigned per part, round robin.
+    HAPI_NodeId MaterialId = -1;
+    const FHoudiniMockNode * AssetNode = FindNode( Node->AssetId );
+    if ( AssetNode && AssetNode->Materials.Num() > 0 && Node->Kind == EHoudiniMockNodeKind::Geo )
+        MaterialId = AssetNode->Materials[ ( Node->Index * Settings.MeshPartsPerObject + part_id ) % AssetNode->Materials.Num() ];
+
+    *are_all_the_same = true;
+    for ( int32 Idx = 0; Idx < length; ++Idx )
+        material_ids_array[ Idx ] = MaterialId;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetInstancedPartIds(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_PartId * instanced_parts_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( HAPI_PartId ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    HAPI_PartInfo PartInfo;
+    if ( !GetPartInfo( *Node, part_id, PartInfo ) || PartInfo.type != HAPI_PARTTYPE_INSTANCER || start != 0 || length != 1
+        || !instanced_parts_array )
+    {
+        return HAPI_RESULT_INVALID_ARGUMENT;
+    }
+
+    instanced_parts_array[ 0 ] = 0;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetInstancerPartTransforms(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_RSTOrder rst_order,
+    HAPI_Transform * transforms_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( HAPI_Transform ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    HAPI_PartInfo PartInfo;
+    if ( !GetPartInfo( *Node, part_id, PartInfo ) || PartInfo.type != HAPI_PARTTYPE_INSTANCER || start < 0 || length < 0
+        || start + length > PartInfo.instanceCount || ( length > 0 && !transforms_array ) )
+    {
+        return HAPI_RESULT_INVALID_ARGUMENT;
+    }
+
+    for ( int32 Idx = 0; Idx < length; ++Idx )
+        GetInstanceTransform( start + Idx, transforms_array[ Idx ] );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetVolumeInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_VolumeInfo * volume_info )
+{
+    RoundTrip( sizeof( HAPI_VolumeInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    HAPI_PartInfo PartInfo;
+    if ( !volume_info || !GetPartInfo( *Node, part_id, PartInfo ) || PartInfo.type != HAPI_PARTTYPE_VOLUME
+        || Node->Kind != EHoudiniMockNodeKind::Geo )
+    {
+        return HAPI_RESULT_INVALID_ARGUMENT;
+    }
+
+    FMemory::Memzero< HAPI_VolumeInfo >( *volume_info );
+    volume_info->nameSH = PartInfo.nameSH;
+    volume_info->type = HAPI_VOLUMETYPE_HOUDINI;
+    volume_info->xLength = Settings.HeightfieldSize;
+    volume_info->yLength = Settings.HeightfieldSize;
+    volume_info->zLength = 1;
+    volume_info->tupleSize = 1;
+    volume_info->storage = HAPI_STORAGETYPE_FLOAT;
+    volume_info->tileSize = 8;
+
+    // The volume transform scales the unit cube to half the volume's extent.
+    volume_info->transform.rotationQuaternion[ 3 ] = 1.0f;
+    volume_info->transform.scale[ 0 ] = Settings.HeightfieldSize * HAPI_UNREAL_MOCK_VOXEL_SIZE * 0.5f;
+    volume_info->transform.scale[ 1 ] = Settings.HeightfieldSize * HAPI_UNREAL_MOCK_VOXEL_SIZE * 0.5f;
+    volume_info->transform.scale[ 2 ] = HAPI_UNREAL_MOCK_VOXEL_SIZE * 0.5f;
+    volume_info->transform.rstOrder = HAPI_SRT;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetVolumeBounds(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * x_min, float * y_min, float * z_min,
+    float * x_max, float * y_max, float * z_max, float * x_center, float * y_center, float * z_center )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    HAPI_PartInfo PartInfo;
+    if ( !GetPartInfo( *Node, part_id, PartInfo ) || PartInfo.type != HAPI_PARTTYPE_VOLUME )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    const float HalfExtent = Settings.HeightfieldSize * HAPI_UNREAL_MOCK_VOXEL_SIZE * 0.5f;
+    const float HalfVoxel = HAPI_UNREAL_MOCK_VOXEL_SIZE * 0.5f;
+
+    if ( x_min ) *x_min = -HalfExtent;
+    if ( y_min ) *y_min = -HalfExtent;
+    if ( z_min ) *z_min = -HalfVoxel;
+    if ( x_max ) *x_max = HalfExtent;
+    if ( y_max ) *y_max = HalfExtent;
+    if ( z_max ) *z_max = HalfVoxel;
+    if ( x_center ) *x_center = 0.0f;
+    if ( y_center ) *y_center = 0.0f;
+    if ( z_center ) *z_center = 0.0f;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetHeightFieldData(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * values_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( float ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    HAPI_PartInfo PartInfo;
+    const int32 Size = Settings.HeightfieldSize;
+    if ( !GetPartInfo( *Node, part_id, PartInfo ) || PartInfo.type != HAPI_PARTTYPE_VOLUME || !values_array || start < 0
+        || length < 0 || start + length > Size * Size )
+    {
+        return HAPI_RESULT_INVALID_ARGUMENT;
+    }
+
+    for ( int32 Idx = 0; Idx < length; ++Idx )
+        values_array[ Idx ] = HoudiniMockEvaluateHeightfield( part_id, ( start + Idx ) % Size, ( start + Idx ) / Size );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetPartInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_PartInfo * part_info )
+{
+    RoundTrip( sizeof( HAPI_PartInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    if ( !part_info || Node->Kind != EHoudiniMockNodeKind::Generic )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    Node->UploadedParts.Add( part_id, *part_info );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::AddAttribute(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info )
+{
+    RoundTrip( sizeof( HAPI_AttributeInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return ( name && attr_info ) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetAttributeFloatData(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info,
+    const float * data_array, int start, int length )
+{
+    const int32 TupleSize = attr_info ? FMath::Max( attr_info->tupleSize, 1 ) : 1;
+    RoundTrip( (int64) length * TupleSize * sizeof( float ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return ( name && attr_info && data_array ) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetAttributeIntData(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info,
+    const int * data_array, int start, int length )
+{
+    const int32 TupleSize = attr_info ? FMath::Max( attr_info->tupleSize, 1 ) : 1;
+    RoundTrip( (int64) length * TupleSize * sizeof( int ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return ( name && attr_info && data_array ) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetAttributeStringData(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info,
+    const char ** data_array, int start, int length )
+{
+    if ( !name || !attr_info || !data_array )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    int64 PayloadBytes = 0;
+    const int32 ValueCount = length * FMath::Max( attr_info->tupleSize, 1 );
+    for ( int32 Idx = 0; Idx < ValueCount; ++Idx )
+        PayloadBytes += data_array[ Idx ] ? FCStringAnsi::Strlen( data_array[ Idx ] ) + 1 : 1;
+
+    RoundTrip( PayloadBytes );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetVertexList(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * vertex_list_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( int ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return vertex_list_array ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetFaceCounts(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * face_counts_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( int ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return face_counts_array ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::AddGroup(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return group_name ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetGroupMembership(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, HAPI_GroupType group_type, const char * group_name,
+    const int * membership_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( int ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return ( group_name && membership_array ) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::CommitGeo( const HAPI_Session * session, HAPI_NodeId node_id )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    Node->CookCount++;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::RevertGeo( const HAPI_Session * session, HAPI_NodeId node_id )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+
+    Node->UploadedParts.Empty();
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetCurveInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_CurveInfo * info )
+{
+    RoundTrip( sizeof( HAPI_CurveInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return info ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetCurveCounts(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * counts_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( int ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return counts_array ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetCurveOrders(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * orders_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( int ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return orders_array ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetCurveKnots(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const float * knots_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( float ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return knots_array ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetVolumeInfo( const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_VolumeInfo * volume_info )
+{
+    RoundTrip( sizeof( HAPI_VolumeInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return volume_info ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetHeightFieldData(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const float * values_array, int start, int length )
+{
+    RoundTrip( (int64) length * sizeof( float ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return ( name && values_array ) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetVolumeTileFloatData(
+    const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const HAPI_VolumeTileInfo * tile, const float * values_array, int length )
+{
+    RoundTrip( (int64) length * sizeof( float ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, node_id );
+    return ( tile && values_array ) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetMaterialInfo( const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_MaterialInfo * material_info )
+{
+    RoundTrip( sizeof( HAPI_MaterialInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, material_node_id );
+
+    if ( !material_info )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    FMemory::Memzero< HAPI_MaterialInfo >( *material_info );
+    material_info->nodeId = Node->Id;
+    material_info->exists = Node->Kind == EHoudiniMockNodeKind::Material;
+    material_info->hasChanged = material_info->exists && IsDirty( *Node );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::RenderTextureToImage( const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_ParmId parm_id )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, material_node_id );
+
+    HAPI_ParmInfo ParmInfo;
+    if ( !FillParmInfo( *Node, parm_id, ParmInfo ) || ParmInfo.type != HAPI_PARMTYPE_PATH_FILE_IMAGE )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    FMemory::Memzero< HAPI_ImageInfo >( Node->ImageInfo );
+    Node->ImageInfo.imageFileFormatNameSH = Intern( TEXT( HAPI_RAW_FORMAT_NAME ) );
+    Node->ImageInfo.xRes = Settings.TextureResolution;
+    Node->ImageInfo.yRes = Settings.TextureResolution;
+    Node->ImageInfo.dataFormat = HAPI_IMAGE_DATA_INT8;
+    Node->ImageInfo.interleaved = true;
+    Node->ImageInfo.packing = HAPI_IMAGE_PACKING_RGBA;
+    Node->ImageInfo.gamma = 2.2;
+    Node->bImageRendered = true;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetImageInfo( const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_ImageInfo * image_info )
+{
+    RoundTrip( sizeof( HAPI_ImageInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, material_node_id );
+
+    if ( !image_info || !Node->bImageRendered )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *image_info = Node->ImageInfo;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::SetImageInfo( const HAPI_Session * session, HAPI_NodeId material_node_id, const HAPI_ImageInfo * image_info )
+{
+    RoundTrip( sizeof( HAPI_ImageInfo ) );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, material_node_id );
+
+    // Images are always served as interleaved 8 bit RGBA.
+    if ( !image_info || !Node->bImageRendered || image_info->dataFormat != HAPI_IMAGE_DATA_INT8
+        || image_info->packing != HAPI_IMAGE_PACKING_RGBA )
+    {
+        return HAPI_RESULT_INVALID_ARGUMENT;
+    }
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetImagePlaneCount( const HAPI_Session * session, HAPI_NodeId material_node_id, int * image_plane_count )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, material_node_id );
+
+    if ( !image_plane_count || !Node->bImageRendered )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *image_plane_count = 2;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetImagePlanes(
+    const HAPI_Session * session, HAPI_NodeId material_node_id, HAPI_StringHandle * image_planes_array, int image_plane_count )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, material_node_id );
+
+    if ( !image_planes_array || image_plane_count != 2 || !Node->bImageRendered )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    image_planes_array[ 0 ] = Intern( TEXT( HAPI_UNREAL_MATERIAL_TEXTURE_COLOR ) );
+    image_planes_array[ 1 ] = Intern( TEXT( HAPI_UNREAL_MATERIAL_TEXTURE_ALPHA ) );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::ExtractImageToMemory(
+    const HAPI_Session * session, HAPI_NodeId material_node_id, const char * image_file_format_name, const char * image_planes,
+    int * buffer_size )
+{
+    RoundTrip();
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, material_node_id );
+
+    if ( !buffer_size || !Node->bImageRendered )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    *buffer_size = Node->ImageInfo.xRes * Node->ImageInfo.yRes * 4;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::GetImageMemoryBuffer( const HAPI_Session * session, HAPI_NodeId material_node_id, char * buffer, int length )
+{
+    RoundTrip( length );
+    HOUDINI_MOCK_LOCK_SESSION();
+    HOUDINI_MOCK_FIND_NODE( Node, material_node_id );
+
+    const int32 Width = Node->ImageInfo.xRes;
+    const int32 Height = Node->ImageInfo.yRes;
+    if ( !buffer || !Node->bImageRendered || length != Width * Height * 4 )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    // Checker board tinted by the material index, with opaque alpha.
+    const uint8 Tint = (uint8) ( 64 + ( Node->Index * 53 ) % 192 );
+    uint8 * Pixel = reinterpret_cast< uint8 * >( buffer );
+    for ( int32 Y = 0; Y < Height; ++Y )
+    {
+        for ( int32 X = 0; X < Width; ++X, Pixel += 4 )
+        {
+            const bool bOdd = ( ( X / 32 ) + ( Y / 32 ) ) & 1;
+            Pixel[ 0 ] = bOdd ? Tint : 255;
+            Pixel[ 1 ] = bOdd ? 255 - Tint : 255;
+            Pixel[ 2 ] = bOdd ? 128 : 255;
+            Pixel[ 3 ] = 255;
+        }
+    }
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::ConvertTransformQuatToMatrix( const HAPI_Session * session, const HAPI_Transform * transform, float * matrix )
+{
+    if ( !transform || !matrix )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    const FTransform Transform(
+        FQuat( transform->rotationQuaternion[ 0 ], transform->rotationQuaternion[ 1 ],
+            transform->rotationQuaternion[ 2 ], transform->rotationQuaternion[ 3 ] ),
+        FVector( transform->position[ 0 ], transform->position[ 1 ], transform->position[ 2 ] ),
+        FVector( transform->scale[ 0 ], transform->scale[ 1 ], transform->scale[ 2 ] ) );
+
+    const FMatrix Matrix = Transform.ToMatrixWithScale();
+    for ( int32 Idx = 0; Idx < 16; ++Idx )
+        matrix[ Idx ] = Matrix.M[ Idx / 4 ][ Idx % 4 ];
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::ConvertMatrixToQuat(
+    const HAPI_Session * session, const float * matrix, HAPI_RSTOrder rst_order, HAPI_Transform * transform_out )
+{
+    if ( !matrix || !transform_out )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    FMatrix Matrix;
+    for ( int32 Idx = 0; Idx < 16; ++Idx )
+        Matrix.M[ Idx / 4 ][ Idx % 4 ] = matrix[ Idx ];
+
+    const FTransform Transform( Matrix );
+    const FVector Position = Transform.GetTranslation();
+    const FQuat Rotation = Transform.GetRotation();
+    const FVector Scale = Transform.GetScale3D();
+
+    FMemory::Memzero< HAPI_Transform >( *transform_out );
+    transform_out->position[ 0 ] = Position.X;
+    transform_out->position[ 1 ] = Position.Y;
+    transform_out->position[ 2 ] = Position.Z;
+    transform_out->rotationQuaternion[ 0 ] = Rotation.X;
+    transform_out->rotationQuaternion[ 1 ] = Rotation.Y;
+    transform_out->rotationQuaternion[ 2 ] = Rotation.Z;
+    transform_out->rotationQuaternion[ 3 ] = Rotation.W;
+    transform_out->scale[ 0 ] = Scale.X;
+    transform_out->scale[ 1 ] = Scale.Y;
+    transform_out->scale[ 2 ] = Scale.Z;
+    transform_out->rstOrder = rst_order;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::ConvertMatrixToEuler(
+    const HAPI_Session * session, const float * matrix, HAPI_RSTOrder rst_order, HAPI_XYZOrder rot_order,
+    HAPI_TransformEuler * transform_out )
+{
+    HAPI_Transform Transform;
+    const HAPI_Result Result = ConvertMatrixToQuat( session, matrix, rst_order, &Transform );
+    if ( Result != HAPI_RESULT_SUCCESS || !transform_out )
+        return Result != HAPI_RESULT_SUCCESS ? Result : HAPI_RESULT_INVALID_ARGUMENT;
+
+    const FRotator Rotator = FQuat(
+        Transform.rotationQuaternion[ 0 ], Transform.rotationQuaternion[ 1 ],
+        Transform.rotationQuaternion[ 2 ], Transform.rotationQuaternion[ 3 ] ).Rotator();
+
+    FMemory::Memzero< HAPI_TransformEuler >( *transform_out );
+    FMemory::Memcpy( transform_out->position, Transform.position, sizeof( Transform.position ) );
+    FMemory::Memcpy( transform_out->scale, Transform.scale, sizeof( Transform.scale ) );
+    transform_out->rotationEuler[ 0 ] = Rotator.Roll;
+    transform_out->rotationEuler[ 1 ] = Rotator.Pitch;
+    transform_out->rotationEuler[ 2 ] = Rotator.Yaw;
+    transform_out->rotationOrder = rot_order;
+    transform_out->rstOrder = rst_order;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniMockHapi::ConvertTransformEulerToMatrix( const HAPI_Session * session, const HAPI_TransformEuler * transform, float * matrix )
+{
+    if ( !transform || !matrix )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    const FRotator Rotator( transform->rotationEuler[ 1 ], transform->rotationEuler[ 2 ], transform->rotationEuler[ 0 ] );
+
+    HAPI_Transform Transform;
+    FMemory::Memzero< HAPI_Transform >( Transform );
+    FMemory::Memcpy( Transform.position, transform->position, sizeof( Transform.position ) );
+    FMemory::Memcpy( Transform.scale, transform->scale, sizeof( Transform.scale ) );
+
+    const FQuat Rotation = Rotator.Quaternion();
+    Transform.rotationQuaternion[ 0 ] = Rotation.X;
+    Transform.rotationQuaternion[ 1 ] = Rotation.Y;
+    Transform.rotationQuaternion[ 2 ] = Rotation.Z;
+    Transform.rotationQuaternion[ 3 ] = Rotation.W;
+
+    return ConvertTransformQuatToMatrix( session, &Transform, matrix );
+}
+
+#undef HOUDINI_MOCK_LOCK_SESSION
+#undef HOUDINI_MOCK_FIND_NODE
+
+bool
+FHoudiniEngineMockApi::IsRequested()
+{
+    return FParse::Param( FCommandLine::Get(), TEXT( "HoudiniMockHAPI" ) );
+}
+
+void
+FHoudiniEngineMockApi::Bind( const FHoudiniEngineMockApiSettings & Settings )
+{
+    {
+        FScopeLock ScopeLock( &FHoudiniMockHapi::CriticalSection );
+
+        FHoudiniMockHapi::Settings = Settings;
+        FHoudiniMockHapi::bBound = true;
+        FHoudiniMockHapi::bSessionOpen = false;
+        FHoudiniMockHapi::bInitialized = false;
+        FHoudiniMockHapi::Nodes.Empty();
+        FHoudiniMockHapi::ComposedChildNodes.Empty();
+        FHoudiniMockHapi::Strings.Empty();
+        FHoudiniMockHapi::StringHandles.Empty();
+        FHoudiniMockHapi::Strings.Add( std::string() );
+    }
+
+    // Entry points which are not implemented keep their empty stubs and fail.
+    FHoudiniApi::FinalizeHAPI();
+
+    FHoudiniApi::CreateInProcessSession = &FHoudiniMockHapi::CreateInProcessSession;
+    FHoudiniApi::CreateThriftSocketSession = &FHoudiniMockHapi::CreateThriftSocketSession;
+    FHoudiniApi::CreateThriftNamedPipeSession = &FHoudiniMockHapi::CreateThriftNamedPipeSession;
+    FHoudiniApi::StartThriftSocketServer = &FHoudiniMockHapi::StartThriftSocketServer;
+    FHoudiniApi::StartThriftNamedPipeServer = &FHoudiniMockHapi::StartThriftNamedPipeServer;
+    FHoudiniApi::IsSessionValid = &FHoudiniMockHapi::IsSessionValid;
+    FHoudiniApi::CloseSession = &FHoudiniMockHapi::CloseSession;
+    FHoudiniApi::Initialize = &FHoudiniMockHapi::Initialize;
+    FHoudiniApi::IsInitialized = &FHoudiniMockHapi::IsInitialized;
+    FHoudiniApi::Cleanup = &FHoudiniMockHapi::Cleanup;
+    FHoudiniApi::GetEnvInt = &FHoudiniMockHapi::GetEnvInt;
+    FHoudiniApi::GetSessionEnvInt = &FHoudiniMockHapi::GetSessionEnvInt;
+    FHoudiniApi::SetServerEnvString = &FHoudiniMockHapi::SetServerEnvString;
+    FHoudiniApi::SetTime = &FHoudiniMockHapi::SetTime;
+    FHoudiniApi::GetStatus = &FHoudiniMockHapi::GetStatus;
+    FHoudiniApi::GetStatusStringBufLength = &FHoudiniMockHapi::GetStatusStringBufLength;
+    FHoudiniApi::GetStatusString = &FHoudiniMockHapi::GetStatusString;
+    FHoudiniApi::GetStringBufLength = &FHoudiniMockHapi::GetStringBufLength;
+    FHoudiniApi::GetString = &FHoudiniMockHapi::GetString;
+
+    FHoudiniApi::LoadAssetLibraryFromFile = &FHoudiniMockHapi::LoadAssetLibraryFromFile;
+    FHoudiniApi::LoadAssetLibraryFromMemory = &FHoudiniMockHapi::LoadAssetLibraryFromMemory;
+    FHoudiniApi::GetAvailableAssetCount = &FHoudiniMockHapi::GetAvailableAssetCount;
+    FHoudiniApi::GetAvailableAssets = &FHoudiniMockHapi::GetAvailableAssets;
+
+    FHoudiniApi::CreateNode = &FHoudiniMockHapi::CreateNode;
+    FHoudiniApi::CreateInputNode = &FHoudiniMockHapi::CreateInputNode;
+    FHoudiniApi::DeleteNode = &FHoudiniMockHapi::DeleteNode;
+    FHoudiniApi::CookNode = &FHoudiniMockHapi::CookNode;
+    FHoudiniApi::GetNodeInfo = &FHoudiniMockHapi::GetNodeInfo;
+    FHoudiniApi::IsNodeValid = &FHoudiniMockHapi::IsNodeValid;
+    FHoudiniApi::GetNodePath = &FHoudiniMockHapi::GetNodePath;
+    FHoudiniApi::ComposeChildNodeList = &FHoudiniMockHapi::ComposeChildNodeList;
+    FHoudiniApi::GetComposedChildNodeList = &FHoudiniMockHapi::GetComposedChildNodeList;
+    FHoudiniApi::ConnectNodeInput = &FHoudiniMockHapi::ConnectNodeInput;
+    FHoudiniApi::DisconnectNodeInput = &FHoudiniMockHapi::DisconnectNodeInput;
+    FHoudiniApi::QueryNodeInput = &FHoudiniMockHapi::QueryNodeInput;
+    FHoudiniApi::GetAssetInfo = &FHoudiniMockHapi::GetAssetInfo;
+
+    FHoudiniApi::GetParameters = &FHoudiniMockHapi::GetParameters;
+    FHoudiniApi::GetParmInfo = &FHoudiniMockHapi::GetParmInfo;
+    FHoudiniApi::GetParmIdFromName = &FHoudiniMockHapi::GetParmIdFromName;
+    FHoudiniApi::GetParmWithTag = &FHoudiniMockHapi::GetParmWithTag;
+    FHoudiniApi::GetParmFloatValues = &FHoudiniMockHapi::GetParmFloatValues;
+    FHoudiniApi::GetParmIntValues = &FHoudiniMockHapi::GetParmIntValues;
+    FHoudiniApi::GetParmStringValues = &FHoudiniMockHapi::GetParmStringValues;
+    FHoudiniApi::SetParmFloatValue = &FHoudiniMockHapi::SetParmFloatValue;
+    FHoudiniApi::SetParmFloatValues = &FHoudiniMockHapi::SetParmFloatValues;
+    FHoudiniApi::SetParmIntValue = &FHoudiniMockHapi::SetParmIntValue;
+    FHoudiniApi::SetParmIntValues = &FHoudiniMockHapi::SetParmIntValues;
+    FHoudiniApi::SetParmStringValue = &FHoudiniMockHapi::SetParmStringValue;
+    FHoudiniApi::SetParmNodeValue = &FHoudiniMockHapi::SetParmNodeValue;
+
+    FHoudiniApi::ComposeObjectList = &FHoudiniMockHapi::ComposeObjectList;
+    FHoudiniApi::GetComposedObjectList = &FHoudiniMockHapi::GetComposedObjectList;
+    FHoudiniApi::GetComposedObjectTransforms = &FHoudiniMockHapi::GetComposedObjectTransforms;
+    FHoudiniApi::GetObjectInfo = &FHoudiniMockHapi::GetObjectInfo;
+    FHoudiniApi::GetObjectTransform = &FHoudiniMockHapi::GetObjectTransform;
+    FHoudiniApi::SetObjectTransform = &FHoudiniMockHapi::SetObjectTransform;
+
+    FHoudiniApi::GetDisplayGeoInfo = &FHoudiniMockHapi::GetDisplayGeoInfo;
+    FHoudiniApi::GetGeoInfo = &FHoudiniMockHapi::GetGeoInfo;
+    FHoudiniApi::GetPartInfo = &FHoudiniMockHapi::GetPartInfo;
+    FHoudiniApi::GetAttributeNames = &FHoudiniMockHapi::GetAttributeNames;
+    FHoudiniApi::GetAttributeInfo = &FHoudiniMockHapi::GetAttributeInfo;
+    FHoudiniApi::GetAttributeFloatData = &FHoudiniMockHapi::GetAttributeFloatData;
+    FHoudiniApi::GetAttributeIntData = &FHoudiniMockHapi::GetAttributeIntData;
+    FHoudiniApi::GetAttributeStringData = &FHoudiniMockHapi::GetAttributeStringData;
+    FHoudiniApi::GetVertexList = &FHoudiniMockHapi::GetVertexList;
+    FHoudiniApi::GetFaceCounts = &FHoudiniMockHapi::GetFaceCounts;
+    FHoudiniApi::GetGroupNames = &FHoudiniMockHapi::GetGroupNames;
+    FHoudiniApi::GetGroupCountOnPackedInstancePart = &FHoudiniMockHapi::GetGroupCountOnPackedInstancePart;
+    FHoudiniApi::GetMaterialNodeIdsOnFaces = &FHoudiniMockHapi::GetMaterialNodeIdsOnFaces;
+    FHoudiniApi::GetInstancedPartIds = &FHoudiniMockHapi::GetInstancedPartIds;
+    FHoudiniApi::GetInstancerPartTransforms = &FHoudiniMockHapi::GetInstancerPartTransforms;
+    FHoudiniApi::GetVolumeInfo = &FHoudiniMockHapi::GetVolumeInfo;
+    FHoudiniApi::GetVolumeBounds = &FHoudiniMockHapi::GetVolumeBounds;
+    FHoudiniApi::GetHeightFieldData = &FHoudiniMockHapi::GetHeightFieldData;
+
+    FHoudiniApi::SetPartInfo = &FHoudiniMockHapi::SetPartInfo;
+    FHoudiniApi::AddAttribute = &FHoudiniMockHapi::AddAttribute;
+    FHoudiniApi::SetAttributeFloatData = &FHoudiniMockHapi::SetAttributeFloatData;
+    FHoudiniApi::SetAttributeIntData = &FHoudiniMockHapi::SetAttributeIntData;
+    FHoudiniApi::SetAttributeStringData = &FHoudiniMockHapi::SetAttributeStringData;
+    FHoudiniApi::SetVertexList = &FHoudiniMockHapi::SetVertexList;
+    FHoudiniApi::SetFaceCounts = &FHoudiniMockHapi::SetFaceCounts;
+    FHoudiniApi::AddGroup = &FHoudiniMockHapi::AddGroup;
+    FHoudiniApi::SetGroupMembership = &FHoudiniMockHapi::SetGroupMembership;
+    FHoudiniApi::CommitGeo = &FHoudiniMockHapi::CommitGeo;
+    FHoudiniApi::RevertGeo = &FHoudiniMockHapi::RevertGeo;
+    FHoudiniApi::SetCurveInfo = &FHoudiniMockHapi::SetCurveInfo;
+    FHoudiniApi::SetCurveCounts = &FHoudiniMockHapi::SetCurveCounts;
+    FHoudiniApi::SetCurveOrders = &FHoudiniMockHapi::SetCurveOrders;
+    FHoudiniApi::SetCurveKnots = &FHoudiniMockHapi::SetCurveKnots;
+    FHoudiniApi::SetVolumeInfo = &FHoudiniMockHapi::SetVolumeInfo;
+    FHoudiniApi::SetHeightFieldData = &FHoudiniMockHapi::SetHeightFieldData;
+    FHoudiniApi::SetVolumeTileFloatData = &FHoudiniMockHapi::SetVolumeTileFloatData;
+
+    FHoudiniApi::GetMaterialInfo = &FHoudiniMockHapi::GetMaterialInfo;
+    FHoudiniApi::RenderTextureToImage = &FHoudiniMockHapi::RenderTextureToImage;
+    FHoudiniApi::GetImageInfo = &FHoudiniMockHapi::GetImageInfo;
+    FHoudiniApi::SetImageInfo = &FHoudiniMockHapi::SetImageInfo;
+    FHoudiniApi::GetImagePlaneCount = &FHoudiniMockHapi::GetImagePlaneCount;
+    FHoudiniApi::GetImagePlanes = &FHoudiniMockHapi::GetImagePlanes;
+    FHoudiniApi::ExtractImageToMemory = &FHoudiniMockHapi::ExtractImageToMemory;
+    FHoudiniApi::GetImageMemoryBuffer = &FHoudiniMockHapi::GetImageMemoryBuffer;
+
+    FHoudiniApi::ConvertTransformQuatToMatrix = &FHoudiniMockHapi::ConvertTransformQuatToMatrix;
+    FHoudiniApi::ConvertMatrixToQuat = &FHoudiniMockHapi::ConvertMatrixToQuat;
+    FHoudiniApi::ConvertMatrixToEuler = &FHoudiniMockHapi::ConvertMatrixToEuler;
+    FHoudiniApi::ConvertTransformEulerToMatrix = &FHoudiniMockHapi::ConvertTransformEulerToMatrix;
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Bound the mock Houdini Engine API: %d mesh objects of %d parts at resolution %d, heightfield %d with %d layers, " )
+        TEXT( "%d instancers of %d instances, %d materials with %d textures, %.1fus latency." ),
+        Settings.MeshObjectCount, Settings.MeshPartsPerObject, Settings.MeshResolution,
+        Settings.HeightfieldSize, Settings.HeightfieldLayerCount, Settings.InstancerCount, Settings.InstancesPerInstancer,
+        Settings.MaterialCount, Settings.TextureResolution, Settings.CallLatencyMicroseconds );
+}
+
+void
+FHoudiniEngineMockApi::Unbind()
+{
+    if ( !IsBound() )
+        return;
+
+    FHoudiniApi::FinalizeHAPI();
+
+    FScopeLock ScopeLock( &FHoudiniMockHapi::CriticalSection );
+    FHoudiniMockHapi::bBound = false;
+    FHoudiniMockHapi::bSessionOpen = false;
+    FHoudiniMockHapi::bInitialized = false;
+    FHoudiniMockHapi::Nodes.Empty();
+    FHoudiniMockHapi::ComposedChildNodes.Empty();
+    FHoudiniMockHapi::Strings.Empty();
+    FHoudiniMockHapi::StringHandles.Empty();
+}
+
+bool
+FHoudiniEngineMockApi::IsBound()
+{
+    FScopeLock ScopeLock( &FHoudiniMockHapi::CriticalSection );
+    return FHoudiniMockHapi::bBound;
+}
+
+FHoudiniEngineMockApiSettings
+FHoudiniEngineMockApi::GetSettings()
+{
+    FScopeLock ScopeLock( &FHoudiniMockHapi::CriticalSection );
+    return FHoudiniMockHapi::Settings;
+}
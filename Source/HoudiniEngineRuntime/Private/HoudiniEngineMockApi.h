@@ -0,0 +1,93 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*/
+
+#pragma once
+
+#include "HAPI_Common.h"
+
+/** Synthetic scene served by the mock Houdini Engine API and the simulated cost of talking to it. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniEngineMockApiSettings
+{
+    FHoudiniEngineMockApiSettings();
+
+    /** Override settings from -HoudiniMock*= command line values. **/
+    void ParseCommandLine( const TCHAR * CommandLine );
+
+    /** Number of mesh objects in each asset and number of mesh parts per object. **/
+    int32 MeshObjectCount;
+    int32 MeshPartsPerObject;
+
+    /** Number of grid cells along each side of a mesh part, a part has 2 * MeshResolution^2 triangles. **/
+    int32 MeshResolution;
+
+    /** Number of heightfield voxels along each side, 0 disables the heightfield object. **/
+    int32 HeightfieldSize;
+
+    /** Number of mask layers next to the height layer. **/
+    int32 HeightfieldLayerCount;
+
+    /** Number of packed primitive instancer objects and instances per instancer. **/
+    int32 InstancerCount;
+    int32 InstancesPerInstancer;
+
+    /** Number of materials, assigned round robin to mesh parts. **/
+    int32 MaterialCount;
+
+    /** Resolution of the diffuse texture of each material, 0 disables textures. **/
+    int32 TextureResolution;
+
+    /** Fixed cost of each call, simulating a session round trip. **/
+    float CallLatencyMicroseconds;
+
+    /** Throughput of the simulated session, 0 means unlimited. **/
+    float BandwidthMegabytesPerSecond;
+
+    /** Time spent cooking each asset. **/
+    float CookMilliseconds;
+
+    /** If set, every cook reports all geos and materials as changed, otherwise only the first cook does. **/
+    bool bDirtyOnEveryCook;
+};
+
+/** Built-in synthetic implementation of the Houdini Engine API. When bound in place of libHAPI, every asset **/
+/** instantiates into a procedurally generated scene of meshes, heightfields, instancers and materials, and input **/
+/** uploads are accepted and discarded. Used to profile and regression-test the plugin without a Houdini install. **/
+class HOUDINIENGINERUNTIME_API FHoudiniEngineMockApi
+{
+    public:
+
+        /** Return true if the mock API was requested on the command line with -HoudiniMockHAPI. **/
+        static bool IsRequested();
+
+        /** Point the FHoudiniApi function table to the mock implementation. **/
+        static void Bind( const FHoudiniEngineMockApiSettings & Settings );
+
+        /** Reset the FHoudiniApi function table and discard the synthetic scene. **/
+        static void Unbind();
+
+        /** Return true if the mock implementation is currently bound. **/
+        static bool IsBound();
+
+        /** Settings used by the bound mock implementation. **/
+        static FHoudiniEngineMockApiSettings GetSettings();
+};
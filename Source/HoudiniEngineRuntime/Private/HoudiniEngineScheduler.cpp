@@ -36,39 +36,117 @@
 #include "HoudiniEngine.h"
 #include "HoudiniAsset.h"
 #include "HoudiniEngineString.h"
-//#include "ScopeLock.h"
+#include "HoudiniEngineAttributeDirectory.h"
+#include "HoudiniRuntimeSettings.h"
+#include "HoudiniEngineApiProfiler.h"
 
-const uint32
-FHoudiniEngineScheduler::InitialTaskSize = 256u;
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT( "Houdini: Cook State Polls" ), STAT_CookStatePolls, STATGROUP_HoudiniEngine );
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT( "Houdini: Wasted Cook State Polls" ), STAT_CookStatePollsWasted, STATGROUP_HoudiniEngine );
 
-FHoudiniEngineScheduler::FHoudiniEngineScheduler()
-    : Tasks( nullptr )
-    , PositionWrite( 0u )
-    , PositionRead( 0u )
-    , bStopping( false )
+/** Implements the cook state polling policy shared by instantiation and cooking tasks. **/
+struct FHoudiniCookStatePoller
 {
-    //  Make sure size is power of two.
-    TaskCount = FPlatformMath::RoundUpToPowerOfTwo( FHoudiniEngineScheduler::InitialTaskSize );
+    FHoudiniCookStatePoller()
+        : PollCount( 0 )
+        , WastedPollCount( 0 )
+    {
+        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+        bAdaptive = HoudiniRuntimeSettings->bAdaptiveCookStatePolling;
+        MinInterval = FMath::Max( HoudiniRuntimeSettings->CookStatePollingMinInterval, 0.0f ) / 1000.0f;
+        MaxInterval = FMath::Max( HoudiniRuntimeSettings->CookStatePollingMaxInterval / 1000.0f, MinInterval );
+        NotificationInterval = HoudiniRuntimeSettings->CookProgressNotificationInterval;
+        Interval = MinInterval;
+
+        StartTime = FPlatformTime::Seconds();
+        LastNotificationTime = StartTime;
+    }
 
-    if ( TaskCount )
+    /** Record the state returned by a poll. **/
+    void RecordPoll( int32 Status )
     {
-        // Allocate buffer to store all tasks.
-        Tasks = static_cast< FHoudiniEngineTask * >( FMemory::Malloc( TaskCount * sizeof( FHoudiniEngineTask ) ) );
+        PollCount++;
+        INC_DWORD_STAT( STAT_CookStatePolls );
 
-        if ( Tasks )
+        if ( Status > HAPI_STATE_MAX_READY_STATE )
         {
-            // Zero memory.
-            FMemory::Memset( Tasks, 0x0, TaskCount * sizeof( FHoudiniEngineTask ) );
+            // Houdini is still busy, this round trip did not give us anything.
+            WastedPollCount++;
+            INC_DWORD_STAT( STAT_CookStatePollsWasted );
         }
     }
+
+    /** Return true if enough time has elapsed since the last progress notification. **/
+    bool ShouldNotify()
+    {
+        const double CurrentTime = FPlatformTime::Seconds();
+        if ( CurrentTime - LastNotificationTime < NotificationInterval )
+            return false;
+
+        LastNotificationTime = CurrentTime;
+        return true;
+    }
+
+    /** Wait before the next poll, doubling the delay up to the cap. **/
+    void Wait()
+    {
+        if ( !bAdaptive )
+        {
+            // We want to yield.
+            FPlatformProcess::Sleep( 0.0f );
+            return;
+        }
+
+        FPlatformProcess::Sleep( Interval );
+        Interval = FMath::Min( FMath::Max( Interval * 2.0f, 0.001f ), MaxInterval );
+    }
+
+    /** Log polling statistics for a finished task. **/
+    void LogSummary( const TCHAR * TaskName, const FString & ActorName ) const
+    {
+        HOUDINI_LOG_MESSAGE(
+            TEXT( "%s for %s took %.3f s, %d cook state polls (%d wasted)." ),
+            TaskName, *ActorName, FPlatformTime::Seconds() - StartTime, PollCount, WastedPollCount );
+    }
+
+    /** Number of cook state polls issued. **/
+    int32 PollCount;
+
+    /** Number of cook state polls which returned a busy state. **/
+    int32 WastedPollCount;
+
+    /** Whether we back off between polls. **/
+    bool bAdaptive;
+
+    /** Polling intervals, in seconds. **/
+    float MinInterval;
+    float MaxInterval;
+    float Interval;
+
+    /** Progress notification interval, in seconds. **/
+    double NotificationInterval;
+
+    /** Time at which polling started. **/
+    double StartTime;
+
+    /** Time at which last progress notification was sent. **/
+    double LastNotificationTime;
+};
+
+FHoudiniEngineScheduler::FHoudiniEngineScheduler()
+    : TaskEvent( nullptr )
+    , bStopping( false )
+{
+    // Auto reset event, a single trigger releases the scheduler thread once.
+    TaskEvent = FPlatformProcess::CreateSynchEvent( false );
 }
 
 FHoudiniEngineScheduler::~FHoudiniEngineScheduler()
 {
-    if ( TaskCount )
+    if ( TaskEvent )
     {
-        FMemory::Free( Tasks );
-        Tasks = nullptr;
+        delete TaskEvent;
+        TaskEvent = nullptr;
     }
 }
 
@@ -98,6 +176,8 @@ FHoudiniEngineScheduler::TaskDescription(
 void
 FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
 {
+    FHoudiniEngineApiProfilerScope ProfilerScope( Task.ActorName, TEXT( "Instantiate" ) );
+
     FString AssetN;
     FHoudiniEngineString( Task.AssetHapiName ).ToFString( AssetN );
 
@@ -147,7 +227,6 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
     int32 AssetCount = 0;
     HAPI_NodeId AssetId = -1;
     std::string AssetNameString;
-    double LastUpdateTime;
 
     FHoudiniEngineString HoudiniEngineString( Task.AssetHapiName );
     if ( HoudiniEngineString.ToStdString( AssetNameString ) )
@@ -155,9 +234,6 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
         // Translate asset name into Unreal string.
         FString AssetName = ANSI_TO_TCHAR( AssetNameString.c_str() );
 
-        // Initialize last update time.
-        LastUpdateTime = FPlatformTime::Seconds();
-
         // We instantiate without cooking.
         Result = FHoudiniApi::CreateNode(
             FHoudiniEngine::Get().GetSession(), -1, &AssetNameString[ 0 ], nullptr, false, &AssetId );
@@ -171,6 +247,9 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
             return;
         }
 
+        // Attribute directories from the previous cook may no longer be valid.
+        FHoudiniEngineAttributeDirectory::Reset();
+
         // Add processing notification.
         FHoudiniEngineTaskInfo TaskInfo(
             HAPI_RESULT_SUCCESS, -1, EHoudiniEngineTaskType::AssetInstantiation,
@@ -180,12 +259,14 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
         TaskDescription( TaskInfo, Task.ActorName, TEXT( "Started Instantiation" ) );
         FHoudiniEngine::Get().AddTaskInfo( Task.HapiGUID, TaskInfo );
 
-        // We need to spin until instantiation is finished.
+        // We need to poll until instantiation is finished.
+        FHoudiniCookStatePoller Poller;
         while( true )
         {
             int Status = HAPI_STATE_STARTING_COOK;
             HOUDINI_CHECK_ERROR( &Result, FHoudiniApi::GetStatus(
                 FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status ) );
+            Poller.RecordPoll( Status );
 
             if ( Status == HAPI_STATE_READY )
             {
@@ -195,6 +276,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
                     EHoudiniEngineTaskState::FinishedInstantiation, AssetId, Task,
                     TEXT( "Finished Instantiation." ) );
 
+                Poller.LogSummary( TEXT( "Instantiation" ), Task.ActorName );
                 break;
             }
             else if ( Status == HAPI_STATE_READY_WITH_FATAL_ERRORS || Status == HAPI_STATE_READY_WITH_COOK_ERRORS )
@@ -209,15 +291,13 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
                     EHoudiniEngineTaskState::FinishedInstantiationWithErrors, AssetId, Task,
                     FString::Printf(TEXT( "Finished Instantiation with Errors: %s" ), *CookResultString ));
 
+                Poller.LogSummary( TEXT( "Instantiation" ), Task.ActorName );
                 break;
             }
 
-            static const double NotificationUpdateFrequency = 0.5;
-            if ( ( FPlatformTime::Seconds() - LastUpdateTime ) >= NotificationUpdateFrequency )
+            // Only fetch the progress string at the notification rate.
+            if ( Poller.ShouldNotify() )
             {
-                // Reset update time.
-                LastUpdateTime = FPlatformTime::Seconds();
-
                 const FString& CookStateMessage = FHoudiniEngineUtils::GetCookState();
 
                 AddResponseMessageTaskInfo(
@@ -226,8 +306,8 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
                     CookStateMessage );
             }
 
-            // We want to yield.
-            FPlatformProcess::Sleep( 0.0f );
+            // Back off before polling again.
+            Poller.Wait();
         }
     }
     else
@@ -244,6 +324,8 @@ FHoudiniEngineScheduler::TaskInstantiateAsset( const FHoudiniEngineTask & Task )
 void
 FHoudiniEngineScheduler::TaskCookAsset( const FHoudiniEngineTask & Task )
 {
+    FHoudiniEngineApiProfilerScope ProfilerScope( Task.ActorName, TEXT( "Cook" ) );
+
     if ( !FHoudiniEngineUtils::IsInitialized() )
     {
         HOUDINI_LOG_ERROR(
@@ -291,20 +373,22 @@ FHoudiniEngineScheduler::TaskCookAsset( const FHoudiniEngineTask & Task )
         return;
     }
 
+    // Attribute directories from the previous cook may no longer be valid.
+    FHoudiniEngineAttributeDirectory::Reset();
+
     // Add processing notification.
     AddResponseMessageTaskInfo(
         HAPI_RESULT_SUCCESS, EHoudiniEngineTaskType::AssetCooking,
         EHoudiniEngineTaskState::Processing, AssetId, Task, TEXT( "Started Cooking" ) );
 
-    // Initialize last update time.
-    double LastUpdateTime = FPlatformTime::Seconds();
-
-    // We need to spin until cooking is finished.
+    // We need to poll until cooking is finished.
+    FHoudiniCookStatePoller Poller;
     while ( true )
     {
         int32 Status = HAPI_STATE_STARTING_COOK;
         HOUDINI_CHECK_ERROR( &Result, FHoudiniApi::GetStatus(
             FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status ) );
+        Poller.RecordPoll( Status );
 
         if ( Status == HAPI_STATE_READY )
         {
@@ -314,6 +398,7 @@ FHoudiniEngineScheduler::TaskCookAsset( const FHoudiniEngineTask & Task )
                 EHoudiniEngineTaskState::FinishedCooking, AssetId, Task,
                 TEXT( "Finished Cooking" ) );
 
+            Poller.LogSummary( TEXT( "Cooking" ), Task.ActorName );
             break;
         }
         else if ( Status == HAPI_STATE_READY_WITH_FATAL_ERRORS || Status == HAPI_STATE_READY_WITH_COOK_ERRORS )
@@ -324,15 +409,13 @@ FHoudiniEngineScheduler::TaskCookAsset( const FHoudiniEngineTask & Task )
                 EHoudiniEngineTaskState::FinishedCookingWithErrors, AssetId, Task,
                 TEXT( "Finished Cooking with Errors" ) );
 
+            Poller.LogSummary( TEXT( "Cooking" ), Task.ActorName );
             break;
         }
 
-        static const double NotificationUpdateFrequency = 0.5;
-        if ( FPlatformTime::Seconds() - LastUpdateTime >= NotificationUpdateFrequency )
+        // Only fetch the progress string at the notification rate.
+        if ( Poller.ShouldNotify() )
         {
-            // Reset update time.
-            LastUpdateTime = FPlatformTime::Seconds();
-
             // Retrieve status string.
             const FString & CookStateMessage = FHoudiniEngineUtils::GetCookState();
 
@@ -342,14 +425,16 @@ FHoudiniEngineScheduler::TaskCookAsset( const FHoudiniEngineTask & Task )
                 CookStateMessage );
         }
 
-        // We want to yield.
-        FPlatformProcess::Sleep( 0.0f );
+        // Back off before polling again.
+        Poller.Wait();
     }
 }
 
 void
 FHoudiniEngineScheduler::TaskDeleteAsset( const FHoudiniEngineTask & Task )
 {
+    FHoudiniEngineApiProfilerScope ProfilerScope( Task.ActorName, TEXT( "Delete" ) );
+
     HOUDINI_LOG_MESSAGE(
         TEXT( "HAPI Asynchronous Destruction Started for %s. " )
         TEXT( "AssetId = %d" ),
@@ -390,28 +475,15 @@ FHoudiniEngineScheduler::AddResponseMessageTaskInfo(
 void
 FHoudiniEngineScheduler::ProcessQueuedTasks()
 {
-    while( !bStopping )
+    while ( !bStopping )
     {
-        while ( true )
-        {
-            FHoudiniEngineTask Task;
+        FHoudiniEngineTask Task;
 
-            {
-                FScopeLock ScopeLock( &CriticalSection );
-
-                // We have no tasks left.
-                if ( PositionWrite == PositionRead )
-                    break;
-
-                // Retrieve task.
-                Task = Tasks[ PositionRead ];
-                PositionRead++;
-
-                // Wrap around if required.
-                PositionRead &= ( TaskCount - 1 );
-            }
-
-            bool bTaskProcessed = true;
+        // Drain all the tasks that have been queued so far.
+        while ( Tasks.Dequeue( Task ) )
+        {
+            // Tasks queued while the session is starting in the background wait for it here.
+            FHoudiniEngine::Get().WaitForSession();
 
             switch ( Task.TaskType )
             {
@@ -435,19 +507,16 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 
                 default:
                 {
-                    bTaskProcessed = false;
                     break;
                 }
             }
-
-            if ( !bTaskProcessed )
-                break;
         }
 
-        if ( FPlatformProcess::SupportsMultithreading() )
+        if ( FPlatformProcess::SupportsMultithreading() && TaskEvent )
         {
-            // We want to yield for a bit.
-            FPlatformProcess::Sleep( 0.0f );
+            // Park the thread until AddTask or Stop wakes us up. A trigger issued while we were
+            // processing keeps the event signaled, so no wake up can be lost here.
+            TaskEvent->Wait();
         }
         else
         {
@@ -460,57 +529,11 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 void
 FHoudiniEngineScheduler::AddTask( const FHoudiniEngineTask & Task )
 {
-    FScopeLock ScopeLock( &CriticalSection );
+    // Queue is lock-free for multiple producers, no need to take a lock here.
+    Tasks.Enqueue( Task );
 
-    // Check if we need to grow our circular buffer.
-    if ( PositionWrite + 1 == PositionRead )
-    {
-        // Calculate next size (next power of two).
-        uint32 NextTaskCount = FPlatformMath::RoundUpToPowerOfTwo( TaskCount + 1 );
-
-        // Allocate new buffer.
-        FHoudiniEngineTask * Buffer = static_cast< FHoudiniEngineTask * >(
-            FMemory::Malloc( NextTaskCount * sizeof( FHoudiniEngineTask ) ) );
-
-        if( !Buffer )
-            return;
-
-        // Zero memory.
-        FMemory::Memset( Buffer, 0x0, NextTaskCount * sizeof( FHoudiniEngineTask ) );
-
-        // Copy elements from old buffer to new one.
-        if ( PositionRead < PositionWrite )
-        {
-            FMemory::Memcpy( Buffer, Tasks + PositionRead, sizeof( FHoudiniEngineTask ) * ( PositionWrite - PositionRead ) );
-
-            // Update index positions.
-            PositionRead = 0;
-            PositionWrite = PositionWrite - PositionRead;
-        }
-        else
-        {
-            FMemory::Memcpy( Buffer, Tasks + PositionRead, sizeof( FHoudiniEngineTask ) * ( TaskCount - PositionRead ) );
-            FMemory::Memcpy( Buffer + TaskCount - PositionRead, Tasks, sizeof( FHoudiniEngineTask ) * PositionWrite );
-
-            // Update index positions.
-            PositionRead = 0;
-            PositionWrite = TaskCount - PositionRead + PositionWrite;
-        }
-
-        // Deallocate old buffer.
-        FMemory::Free( Tasks );
-
-        // Bookkeeping.
-        Tasks = Buffer;
-        TaskCount = NextTaskCount;
-    }
-
-    // Store task.
-    Tasks[ PositionWrite ] = Task;
-    PositionWrite++;
-
-    // Wrap around if required.
-    PositionWrite &= ( TaskCount - 1 );
+    if ( TaskEvent )
+        TaskEvent->Trigger();
 }
 
 uint32
@@ -524,6 +547,10 @@ void
 FHoudiniEngineScheduler::Stop()
 {
     bStopping = true;
+
+    // Wake up the scheduler thread so it can exit.
+    if ( TaskEvent )
+        TaskEvent->Trigger();
 }
 
 void
@@ -37,6 +37,7 @@
 //#include "RunnableThread.h"
 //#include "SingleThreadRunnable.h"
 #include "ThreadingBase.h"
+#include "Queue.h"
 
 
 class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
@@ -93,26 +94,12 @@ class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
 
     protected:
 
-        /** Initial number of tasks in our circular queue. **/
-        static const uint32 InitialTaskSize;
+        /** Lock-free queue of scheduled tasks, filled by any thread and drained by the scheduler thread. **/
+        TQueue< FHoudiniEngineTask, EQueueMode::Mpsc > Tasks;
 
-    protected:
-
-        /** Synchronization primitive. **/
-        FCriticalSection CriticalSection;
-
-        /** List of scheduled tasks. **/
-        FHoudiniEngineTask* Tasks;
-
-        /** Head of the circular queue. **/
-        uint32 PositionWrite;
-
-        /** Tail of the circular queue. **/
-        uint32 PositionRead;
-
-        /** Size of the circular queue. **/
-        uint32 TaskCount;
+        /** Event used to wake up the scheduler thread when a task is added or when we are stopping. **/
+        FEvent * TaskEvent;
 
         /** Stopping flag. **/
-        bool bStopping;
+        volatile bool bStopping;
 };
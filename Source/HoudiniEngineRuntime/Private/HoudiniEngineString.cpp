@@ -153,3 +153,141 @@ FHoudiniEngineString::ToFText( FText & Text ) const
 
     return false;
 }
+
+FCriticalSection
+FHoudiniEngineStringCache::CriticalSection;
+
+TMap< int32, FString >
+FHoudiniEngineStringCache::Strings;
+
+TMap< int32, FName >
+FHoudiniEngineStringCache::Names;
+
+int32
+FHoudiniEngineStringCache::ScopeCount = 0;
+
+const FString *
+FHoudiniEngineStringCache::FindOrResolve( int32 StringId )
+{
+    if ( const FString * FoundString = Strings.Find( StringId ) )
+        return FoundString;
+
+    FString String = TEXT( "" );
+    if ( !FHoudiniEngineString( StringId ).ToFString( String ) )
+        return nullptr;
+
+    return &Strings.Add( StringId, String );
+}
+
+void
+FHoudiniEngineStringCache::DiscardUnscoped()
+{
+    if ( ScopeCount > 0 )
+        return;
+
+    Strings.Empty();
+    Names.Empty();
+}
+
+bool
+FHoudiniEngineStringCache::ResolveHandles( const TArray< int32 > & StringIds, TArray< FString > & OutStrings )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    OutStrings.SetNum( StringIds.Num() );
+
+    // Most handles repeat (materials, instance paths, groups...), so we remember the last handle
+    // to avoid hashing runs of identical values.
+    bool bSuccess = true;
+    int32 LastStringId = -1;
+    const FString * LastString = nullptr;
+
+    for ( int32 Idx = 0, Num = StringIds.Num(); Idx < Num; ++Idx )
+    {
+        const int32 StringId = StringIds[ Idx ];
+        if ( StringId != LastStringId || !LastString )
+        {
+            LastStringId = StringId;
+            LastString = FindOrResolve( StringId );
+        }
+
+        if ( LastString )
+        {
+            OutStrings[ Idx ] = *LastString;
+        }
+        else
+        {
+            OutStrings[ Idx ] = TEXT( "" );
+            bSuccess = false;
+        }
+    }
+
+    DiscardUnscoped();
+
+    return bSuccess;
+}
+
+bool
+FHoudiniEngineStringCache::ToFString( int32 StringId, FString & String )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    const FString * FoundString = FindOrResolve( StringId );
+    String = FoundString ? *FoundString : FString( TEXT( "" ) );
+    const bool bFound = FoundString != nullptr;
+
+    DiscardUnscoped();
+
+    return bFound;
+}
+
+bool
+FHoudiniEngineStringCache::ToFName( int32 StringId, FName & Name )
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    if ( const FName * FoundName = Names.Find( StringId ) )
+    {
+        Name = *FoundName;
+        return true;
+    }
+
+    Name = NAME_None;
+    const FString * FoundString = FindOrResolve( StringId );
+    const bool bFound = FoundString != nullptr;
+    if ( bFound )
+        Name = Names.Add( StringId, FName( **FoundString ) );
+
+    DiscardUnscoped();
+
+    return bFound;
+}
+
+void
+FHoudiniEngineStringCache::Reset()
+{
+    FScopeLock ScopeLock( &CriticalSection );
+
+    Strings.Empty();
+    Names.Empty();
+}
+
+FHoudiniEngineStringCacheScope::FHoudiniEngineStringCacheScope()
+{
+    FScopeLock ScopeLock( &FHoudiniEngineStringCache::CriticalSection );
+
+    // Strings resolved before this scope may belong to an older cook.
+    if ( FHoudiniEngineStringCache::ScopeCount++ == 0 )
+    {
+        FHoudiniEngineStringCache::Strings.Empty();
+        FHoudiniEngineStringCache::Names.Empty();
+    }
+}
+
+FHoudiniEngineStringCacheScope::~FHoudiniEngineStringCacheScope()
+{
+    FScopeLock ScopeLock( &FHoudiniEngineStringCache::CriticalSection );
+
+    --FHoudiniEngineStringCache::ScopeCount;
+    FHoudiniEngineStringCache::DiscardUnscoped();
+}
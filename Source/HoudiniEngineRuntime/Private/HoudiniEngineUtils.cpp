@@ -26,10 +26,14 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniAssetActor.h"
+#include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
 #include "HoudiniAssetComponentMaterials.h"
 #include "HoudiniAsset.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniEngineAttributeDirectory.h"
+#include "HoudiniEngineInputMeshCache.h"
+#include "HoudiniEngineAssetLibraryCache.h"
 #include "HoudiniAttributeDataComponent.h"
 #include "HoudiniLandscapeUtils.h"
 #include "HoudiniEngineBakeUtils.h"
@@ -80,6 +84,7 @@
 #endif
 
 #include "HAL/Platform.h"
+#include "Async/ParallelFor.h"
 //#include "HAL/PlatformMisc.h"
 //#include "HAL/PlatformApplicationMisc.h"
 
@@ -88,6 +93,7 @@
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
 
 DECLARE_CYCLE_STAT( TEXT( "Houdini: Build Static Mesh" ), STAT_BuildStaticMesh, STATGROUP_HoudiniEngine );
+DECLARE_CYCLE_STAT( TEXT( "Houdini: Build Raw Meshes" ), STAT_BuildRawMeshes, STATGROUP_HoudiniEngine );
 
 const FString kResultStringSuccess( TEXT( "Success" ) );
 const FString kResultStringFailure( TEXT( "Generic Failure" ) );
@@ -191,6 +197,10 @@ FHoudiniEngineUtils::GetCookResult()
 bool
 FHoudiniEngineUtils::IsInitialized()
 {
+    // Do not block on a session that is still starting in the background.
+    if ( FHoudiniEngine::Get().IsSessionStarting() )
+        return false;
+
     return ( FHoudiniApi::IsHAPIInitialized() &&
         FHoudiniApi::IsInitialized( FHoudiniEngine::Get().GetSession() ) == HAPI_RESULT_SUCCESS );
 }
@@ -349,6 +359,9 @@ FHoudiniEngineUtils::IsHoudiniNodeValid( const HAPI_NodeId& NodeId )
 bool
 FHoudiniEngineUtils::DestroyHoudiniAsset( HAPI_NodeId AssetId )
 {
+    // Shared input meshes are destroyed along with their last reference.
+    FHoudiniEngineInputMeshCache::ReleaseReference( AssetId );
+
     return FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), AssetId ) == HAPI_RESULT_SUCCESS;
 }
 
@@ -767,14 +780,7 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
     HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
     HAPI_PartId PartId, const char * Name)
 {
-    for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-    {
-        if (HapiCheckAttributeExists(AssetId, ObjectId, GeoId,
-            PartId, Name, (HAPI_AttributeOwner)AttrIdx))
-            return true;
-    }
-
-    return false;
+    return FHoudiniEngineAttributeDirectory::HasAttribute( GeoId, PartId, Name, HAPI_ATTROWNER_INVALID );
 }
 
 bool
@@ -782,17 +788,7 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
     HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
     HAPI_PartId PartId, const char * Name, HAPI_AttributeOwner Owner )
 {
-    HAPI_AttributeInfo AttribInfo;
-    FMemory::Memzero< HAPI_AttributeInfo >( AttribInfo );
-
-    if ( FHoudiniApi::GetAttributeInfo(
-        FHoudiniEngine::Get().GetSession(),
-        GeoId, PartId, Name, Owner, &AttribInfo ) != HAPI_RESULT_SUCCESS )
-    {
-        return false;
-    }
-
-    return AttribInfo.exists;
+    return FHoudiniEngineAttributeDirectory::HasAttribute( GeoId, PartId, Name, Owner );
 }
 
 bool
@@ -821,24 +817,9 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
     HAPI_AttributeInfo AttributeInfo;
     FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
 
-    if ( Owner == HAPI_ATTROWNER_INVALID )
-    {
-        for ( int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx )
-        {
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
-                FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name,
-                (HAPI_AttributeOwner) AttrIdx, &AttributeInfo ), false );
-
-            if ( AttributeInfo.exists )
-                break;
-        }
-    }
-    else
-    {
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
-            FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name,
-            Owner, &AttributeInfo ), false );
-    }
+    // Only the owner holding the attribute is queried, missing attributes are answered by the part's directory.
+    if ( !FHoudiniEngineAttributeDirectory::GetAttributeInfo( GeoId, PartId, Name, Owner, AttributeInfo ) )
+        return false;
 
     if ( !AttributeInfo.exists )
         return false;
@@ -884,24 +865,9 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
     HAPI_AttributeInfo AttributeInfo;
     FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
 
-    if ( Owner == HAPI_ATTROWNER_INVALID )
-    {
-        for ( int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx )
-        {
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
-                FHoudiniEngine::Get().GetSession(),
-                GeoId, PartId, Name, (HAPI_AttributeOwner) AttrIdx, &AttributeInfo ), false );
-
-            if ( AttributeInfo.exists )
-                break;
-        }
-    }
-    else
-    {
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
-            FHoudiniEngine::Get().GetSession(),
-            GeoId, PartId, Name, Owner, &AttributeInfo ), false );
-    }
+    // Only the owner holding the attribute is queried, missing attributes are answered by the part's directory.
+    if ( !FHoudiniEngineAttributeDirectory::GetAttributeInfo( GeoId, PartId, Name, Owner, AttributeInfo ) )
+        return false;
 
     if ( !AttributeInfo.exists )
         return false;
@@ -948,24 +914,9 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
     HAPI_AttributeInfo AttributeInfo;
     FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
 
-    if ( Owner == HAPI_ATTROWNER_INVALID )
-    {
-        for ( int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx )
-        {
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
-                FHoudiniEngine::Get().GetSession(),
-                GeoId, PartId, Name, (HAPI_AttributeOwner) AttrIdx, &AttributeInfo ), false );
-
-            if ( AttributeInfo.exists )
-                break;
-        }
-    }
-    else
-    {
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
-            FHoudiniEngine::Get().GetSession(),
-            GeoId, PartId, Name, Owner, &AttributeInfo ), false );
-    }
+    // Only the owner holding the attribute is queried, missing attributes are answered by the part's directory.
+    if ( !FHoudiniEngineAttributeDirectory::GetAttributeInfo( GeoId, PartId, Name, Owner, AttributeInfo ) )
+        return false;
 
     if ( !AttributeInfo.exists )
         return false;
@@ -979,13 +930,8 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
         FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name, &AttributeInfo,
         &StringHandles[ 0 ], 0, AttributeInfo.count ), false );
 
-    for ( int32 Idx = 0; Idx < StringHandles.Num(); ++Idx )
-    {
-        FString HapiString = TEXT( "" );
-        FHoudiniEngineString HoudiniEngineString( StringHandles[ Idx ] );
-        HoudiniEngineString.ToFString( HapiString );
-        Data.Add( HapiString );
-    }
+    // Resolve the handles through the cook's string cache, each unique handle is only fetched once.
+    FHoudiniEngineStringCache::ResolveHandles( StringHandles, Data );
 
     // Store the retrieved attribute information.
     ResultAttributeInfo = AttributeInfo;
@@ -1342,6 +1288,41 @@ FHoudiniEngineUtils::HapiCreateCurveNode( HAPI_NodeId & ConnectedAssetId )
     return true;
 }
 
+bool
+FHoudiniEngineUtils::HapiIsCurveNode( HAPI_NodeId NodeId )
+{
+    if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( NodeId ) )
+        return false;
+
+    // Input nodes may not report asset info, this is not an error.
+    HAPI_AssetInfo NodeAssetInfo;
+    if ( FHoudiniApi::GetAssetInfo( FHoudiniEngine::Get().GetSession(), NodeId, &NodeAssetInfo ) != HAPI_RESULT_SUCCESS )
+        return false;
+
+    FHoudiniEngineString AssetOpName( NodeAssetInfo.fullOpNameSH );
+    FString OpName;
+    if ( !AssetOpName.ToFString( OpName ) )
+        return false;
+
+    return OpName.EndsWith( TEXT( "/curve" ), ESearchCase::IgnoreCase );
+}
+
+/** Destroy a curve input node along with the OBJ node created for it, and reset its id. **/
+static void
+HoudiniDestroyCurveInputNode( HAPI_NodeId & ConnectedAssetId )
+{
+    // The parent is looked up first, it is gone once the node is destroyed.
+    HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId( ConnectedAssetId );
+
+    if ( FHoudiniEngineUtils::IsHoudiniNodeValid( ConnectedAssetId ) )
+        FHoudiniEngineUtils::DestroyHoudiniAsset( ConnectedAssetId );
+
+    if ( FHoudiniEngineUtils::IsHoudiniNodeValid( ParentId ) )
+        FHoudiniEngineUtils::DestroyHoudiniAsset( ParentId );
+
+    ConnectedAssetId = -1;
+}
+
 bool
 FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
     HAPI_NodeId HostAssetId,
@@ -1362,6 +1343,10 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
     if ( ( NumberOfCVs < 2 ) || !FHoudiniEngineUtils::IsHoudiniNodeValid( HostAssetId ) )
         return false;
 
+    // The connected node might be an input node created for attributes, it needs to be replaced by a curve SOP.
+    if ( ( ConnectedAssetId >= 0 ) && !FHoudiniEngineUtils::HapiIsCurveNode( ConnectedAssetId ) )
+        HoudiniDestroyCurveInputNode( ConnectedAssetId );
+
     // Check if connected asset id is valid, if it is not, we need to create an input asset.
     if (ConnectedAssetId < 0)
     {
@@ -2092,6 +2077,208 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
     return true;
 }
 
+bool
+FHoudiniEngineUtils::HapiCreateCurveInputNodeForAttributes(
+    HAPI_NodeId HostAssetId,
+    HAPI_NodeId & ConnectedAssetId,
+    const TArray< FVector > & Positions,
+    const TArray< FQuat > * Rotations,
+    const TArray< FVector > * Scales3d,
+    const TArray< float > * UniformScales )
+{
+#if WITH_EDITOR
+
+    // We need a valid host asset and 2 points to make a curve.
+    const int32 NumberOfPoints = Positions.Num();
+    if ( ( NumberOfPoints < 2 ) || !FHoudiniEngineUtils::IsHoudiniNodeValid( HostAssetId ) )
+        return false;
+
+    // Attributes are only added if they have a value per point.
+    const bool bAddRotations = Rotations && ( Rotations->Num() == NumberOfPoints );
+    const bool bAddScales3d = Scales3d && ( Scales3d->Num() == NumberOfPoints );
+    const bool bAddUniformScales = UniformScales && ( UniformScales->Num() == NumberOfPoints );
+
+    // The connected node might be a curve SOP created for data, it needs to be replaced by an input node.
+    if ( ( ConnectedAssetId >= 0 )
+        && ( !FHoudiniEngineUtils::IsHoudiniNodeValid( ConnectedAssetId ) || FHoudiniEngineUtils::HapiIsCurveNode( ConnectedAssetId ) ) )
+        HoudiniDestroyCurveInputNode( ConnectedAssetId );
+
+    // Check if connected asset id is valid, if it is not, we need to create an input node.
+    if ( ConnectedAssetId < 0 )
+    {
+        HAPI_NodeId InputNodeId = -1;
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputNode(
+            FHoudiniEngine::Get().GetSession(), &InputNodeId, nullptr ), false );
+
+        // Check if we have a valid id for this new input asset.
+        if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( InputNodeId ) )
+            return false;
+
+        // We now have a valid id.
+        ConnectedAssetId = InputNodeId;
+    }
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
+    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
+
+    if ( HoudiniRuntimeSettings )
+    {
+        GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
+        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
+    }
+
+    // The points are sent as a single open linear curve.
+    HAPI_PartInfo Part;
+    FMemory::Memzero< HAPI_PartInfo >( Part );
+    Part.id = 0;
+    Part.nameSH = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_POINT ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_PRIM ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_VERTEX ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_DETAIL ] = 0;
+    Part.vertexCount = NumberOfPoints;
+    Part.faceCount = 1;
+    Part.pointCount = NumberOfPoints;
+    Part.type = HAPI_PARTTYPE_CURVE;
+
+    HAPI_GeoInfo DisplayGeoInfo;
+    FMemory::Memzero< HAPI_GeoInfo >( DisplayGeoInfo );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetDisplayGeoInfo(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, &DisplayGeoInfo ), false );
+
+    const HAPI_NodeId GeoNodeId = DisplayGeoInfo.nodeId;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetPartInfo(
+        FHoudiniEngine::Get().GetSession(), GeoNodeId, 0, &Part ), false );
+
+    HAPI_CurveInfo CurveInfo;
+    FMemory::Memzero< HAPI_CurveInfo >( CurveInfo );
+    CurveInfo.curveType = HAPI_CURVETYPE_LINEAR;
+    CurveInfo.curveCount = 1;
+    CurveInfo.vertexCount = NumberOfPoints;
+    CurveInfo.knotCount = 0;
+    CurveInfo.isPeriodic = false;
+    CurveInfo.isRational = false;
+    CurveInfo.order = 2;
+    CurveInfo.hasKnots = false;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetCurveInfo(
+        FHoudiniEngine::Get().GetSession(), GeoNodeId, 0, &CurveInfo ), false );
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetCurveCounts(
+        FHoudiniEngine::Get().GetSession(), GeoNodeId, 0, &NumberOfPoints, 0, 1 ), false );
+
+    // Single buffer reused for every attribute we upload.
+    TArray< float > AttributeData;
+
+    // Lambda adding a float point attribute and uploading the content of AttributeData to it.
+    auto SetPointAttribute = [ & ]( const char * AttributeName, int32 TupleSize )
+    {
+        HAPI_AttributeInfo AttributeInfo;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
+        AttributeInfo.count = NumberOfPoints;
+        AttributeInfo.tupleSize = TupleSize;
+        AttributeInfo.exists = true;
+        AttributeInfo.owner = HAPI_ATTROWNER_POINT;
+        AttributeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+        AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+            FHoudiniEngine::Get().GetSession(), GeoNodeId, 0,
+            AttributeName, &AttributeInfo ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), GeoNodeId, 0,
+            AttributeName, &AttributeInfo,
+            AttributeData.GetData(), 0, AttributeInfo.count ), false );
+
+        return true;
+    };
+
+    // Positions, converted the same way CreatePositionsString does.
+    AttributeData.SetNumUninitialized( NumberOfPoints * 3 );
+    for ( int32 Idx = 0; Idx < NumberOfPoints; ++Idx )
+    {
+        FVector Position = Positions[ Idx ];
+
+        if ( ImportAxis == HRSAI_Unreal )
+            Swap( Position.Z, Position.Y );
+
+        if ( GeneratedGeometryScaleFactor != 0.0f )
+            Position /= GeneratedGeometryScaleFactor;
+
+        AttributeData[ Idx * 3 + 0 ] = Position.X;
+        AttributeData[ Idx * 3 + 1 ] = Position.Y;
+        AttributeData[ Idx * 3 + 2 ] = Position.Z;
+    }
+
+    if ( !SetPointAttribute( HAPI_UNREAL_ATTRIB_POSITION, 3 ) )
+        return false;
+
+    if ( bAddRotations )
+    {
+        AttributeData.SetNumUninitialized( NumberOfPoints * 4 );
+        for ( int32 Idx = 0; Idx < NumberOfPoints; ++Idx )
+        {
+            const FQuat & RotationQuaternion = ( *Rotations )[ Idx ];
+
+            if ( ImportAxis == HRSAI_Unreal )
+            {
+                AttributeData[ Idx * 4 + 0 ] = RotationQuaternion.X;
+                AttributeData[ Idx * 4 + 1 ] = RotationQuaternion.Z;
+                AttributeData[ Idx * 4 + 2 ] = RotationQuaternion.Y;
+                AttributeData[ Idx * 4 + 3 ] = -RotationQuaternion.W;
+            }
+            else
+            {
+                AttributeData[ Idx * 4 + 0 ] = RotationQuaternion.X;
+                AttributeData[ Idx * 4 + 1 ] = RotationQuaternion.Y;
+                AttributeData[ Idx * 4 + 2 ] = RotationQuaternion.Z;
+                AttributeData[ Idx * 4 + 3 ] = RotationQuaternion.W;
+            }
+        }
+
+        if ( !SetPointAttribute( HAPI_UNREAL_ATTRIB_ROTATION, 4 ) )
+            return false;
+    }
+
+    if ( bAddScales3d )
+    {
+        AttributeData.SetNumUninitialized( NumberOfPoints * 3 );
+        for ( int32 Idx = 0; Idx < NumberOfPoints; ++Idx )
+        {
+            const FVector & ScaleVector = ( *Scales3d )[ Idx ];
+
+            AttributeData[ Idx * 3 + 0 ] = ScaleVector.X;
+            AttributeData[ Idx * 3 + 1 ] = ( ImportAxis == HRSAI_Unreal ) ? ScaleVector.Z : ScaleVector.Y;
+            AttributeData[ Idx * 3 + 2 ] = ( ImportAxis == HRSAI_Unreal ) ? ScaleVector.Y : ScaleVector.Z;
+        }
+
+        if ( !SetPointAttribute( HAPI_UNREAL_ATTRIB_SCALE, 3 ) )
+            return false;
+    }
+
+    if ( bAddUniformScales )
+    {
+        AttributeData = *UniformScales;
+        if ( !SetPointAttribute( HAPI_UNREAL_ATTRIB_UNIFORM_SCALE, 1 ) )
+            return false;
+    }
+
+    // Commit the geo and cook it, once.
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+        FHoudiniEngine::Get().GetSession(), GeoNodeId ), false );
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, nullptr ), false );
+
+#endif // WITH_EDITOR
+
+    return true;
+}
+
 bool
 FHoudiniEngineUtils::HapiGetAssetTransform( HAPI_NodeId AssetId, FTransform & InTransform )
 {
@@ -2265,7 +2452,8 @@ FHoudiniEngineUtils::HapiCreateInputNodeForLandscape(
     const bool& bExportMaterials, const bool& bExportGeometryAsMesh,
     const bool& bExportLighting, const bool& bExportNormalizedUVs,
     const bool& bExportTileUVs, const FBox& AssetBounds,
-    const bool& bExportAsHeighfield, const bool& bAutoSelectComponents )
+    const bool& bExportAsHeighfield, const bool& bAutoSelectComponents,
+    FHoudiniLandscapeHeightfieldState * OutHeightfieldState )
 {
 #if WITH_EDITOR
 
@@ -2346,7 +2534,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForLandscape(
         if ( !bExportOnlySelected || ( SelectedComponents.Num() == NumComponents ) )
         {
             // Export the whole landscape and its layer as a single heightfield
-            bSuccess = FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape( LandscapeProxy, MergeId );
+            bSuccess = FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape( LandscapeProxy, MergeId, OutHeightfieldState );
         }
         else
         {
@@ -2602,7 +2790,22 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSpline(
         }
     }
 
-    if ( !HapiCreateCurveInputNodeForData(
+    // The refined points are uploaded as a polyline, so they can be sent directly as attributes
+    // and cooked once, instead of going through the coords string of a curve SOP.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    const bool bUseCurveAttributes = !HoudiniRuntimeSettings || HoudiniRuntimeSettings->bMarshallingSplinesAsCurveAttributes;
+
+    if ( bUseCurveAttributes )
+    {
+        if ( !HapiCreateCurveInputNodeForAttributes(
+            HostAssetId,
+            ConnectedAssetId,
+            tRefinedSplinePositions,
+            &tRefinedSplineRotations,
+            &tRefinedSplineScales ) )
+            return false;
+    }
+    else if ( !HapiCreateCurveInputNodeForData(
             HostAssetId, 
             ConnectedAssetId,
             &tRefinedSplinePositions,
@@ -2629,96 +2832,372 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSpline(
         //OutlinerMesh.SplineControlPointsTransform[n].SetRotation(SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World));
     }
 
-    // Cook the spline node.
-    FHoudiniApi::CookNode( FHoudiniEngine::Get().GetSession(), ConnectedAssetId, nullptr );
+    // Cook the spline node, the attribute path has already cooked it.
+    if ( !bUseCurveAttributes )
+        FHoudiniApi::CookNode( FHoudiniEngine::Get().GetSession(), ConnectedAssetId, nullptr );
 
 #endif
 
     return true;
 }
 
-bool
-FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
-    UStaticMesh * StaticMesh,
-    HAPI_NodeId & ConnectedAssetId,
-    TArray< HAPI_NodeId >& OutCreatedNodeIds,
-    UStaticMeshComponent* StaticMeshComponent /* = nullptr */,
-    const bool& ExportAllLODs /* = false */,
-    const bool& ExportSockets /* = false */)
-{
 #if WITH_EDITOR
 
-    // If we don't have a static mesh there's nothing to do.
-    if ( !StaticMesh )
-        return false;
+/** Buffers used to convert input meshes to the layouts expected by HAPI. **/
+struct FHoudiniInputMeshStagingBuffers
+{
+    /** Converted positions, normals, UVs and colors. **/
+    TArray< float > Floats;
 
-    // Export sockets if there are some
-    bool DoExportSockets = ExportSockets && ( StaticMesh->Sockets.Num() > 0 );
+    /** Converted vertex indices. **/
+    TArray< int32 > Indices;
 
-    // Export LODs if there are some
-    bool DoExportLODs = ExportAllLODs && ( StaticMesh->GetNumLODs() > 1 );
+    /** Face counts, only ever filled with triangles. **/
+    TArray< int32 > FaceCounts;
 
-    // We need to use a merge node if we export lods OR sockets
-    bool UseMergeNode = DoExportLODs || DoExportSockets;
+    /** Per face string pointers. **/
+    TArray< const char * > Strings;
 
-    if ( UseMergeNode )
-    {
-        // Create a merge SOP asset. This will be our "ConnectedAssetId".
-        // All the different LOD meshes will be plugged into it
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
-            FHoudiniEngine::Get().GetSession(), -1,
-            "SOP/merge", "input", true, &ConnectedAssetId ), false );
-    }
-    else if ( ConnectedAssetId < 0 )
+    /** Release the arrays whose allocation grew past the given size. **/
+    void Shrink( SIZE_T MaxRetainedBytes )
     {
-        // No LOD, we need a single input node
-        // If connected asset id is invalid, we need to create an input node.
-        HAPI_NodeId InputNodeId = -1;
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputNode(
-            FHoudiniEngine::Get().GetSession(), &InputNodeId, nullptr ), false );
+        if ( Floats.GetAllocatedSize() > MaxRetainedBytes )
+            Floats.Empty();
 
-        // Check if we have a valid id for this new input asset.
-        if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( InputNodeId ) )
-            return false;
+        if ( Indices.GetAllocatedSize() > MaxRetainedBytes )
+            Indices.Empty();
 
-        // We now have a valid id.
-        ConnectedAssetId = InputNodeId;
+        if ( FaceCounts.GetAllocatedSize() > MaxRetainedBytes )
+            FaceCounts.Empty();
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
-            FHoudiniEngine::Get().GetSession(), InputNodeId, nullptr ), false );
+        if ( Strings.GetAllocatedSize() > MaxRetainedBytes )
+            Strings.Empty();
     }
+};
 
-    // Get the input's parent OBJ node
-    HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId( ConnectedAssetId );
-    OutCreatedNodeIds.AddUnique( ParentId );
-
-    // Get runtime settings.
-    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-    check( HoudiniRuntimeSettings );
+/** Maximum number of staging buffers kept in the pool, extra buffers are deleted when returned. **/
+static const int32 HoudiniInputMeshStagingBuffersMaxPooled = 4;
 
-    float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
-    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
-    int32 GeneratedLightMapResolution = 32;
+/** Maximum allocation kept per staging array when returned to the pool. **/
+static const SIZE_T HoudiniInputMeshStagingBuffersMaxRetainedBytes = 16 * 1024 * 1024;
 
-    if ( HoudiniRuntimeSettings )
-    {
-        GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
-        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
-        GeneratedLightMapResolution = HoudiniRuntimeSettings->LightMapResolution;
-    }
+/** Borrows staging buffers from a pool for the lifetime of this object. Buffers keep reasonably sized **/
+/** allocations when returned, so uploading meshes of similar sizes again does not allocate. **/
+class FHoudiniScopedInputMeshStagingBuffers
+{
+    public:
 
-    int32 NumLODsToExport = DoExportLODs ? StaticMesh->GetNumLODs() : 1;
-    for ( int32 LODIndex = 0; LODIndex < NumLODsToExport; LODIndex++ )
-    {
-        // Grab the LOD level.
-#if WITH_EDITORONLY_DATA
-    FStaticMeshSourceModel & SrcModel = StaticMesh->SourceModels[LODIndex];
+        FHoudiniScopedInputMeshStagingBuffers()
+        {
+            FScopeLock ScopeLock( &CriticalSection );
+            Buffers = FreeBuffers.Num() > 0 ? FreeBuffers.Pop( false ) : new FHoudiniInputMeshStagingBuffers();
+        }
 
-        // If we're using a merge node, we need to create a new input null
-        HAPI_NodeId CurrentLODNodeId = -1;
-        if ( UseMergeNode )
+        ~FHoudiniScopedInputMeshStagingBuffers()
         {
-            // Create a new input node for the current LOD
+            Buffers->Shrink( HoudiniInputMeshStagingBuffersMaxRetainedBytes );
+
+            FScopeLock ScopeLock( &CriticalSection );
+            if ( FreeBuffers.Num() < HoudiniInputMeshStagingBuffersMaxPooled )
+                FreeBuffers.Add( Buffers );
+            else
+                delete Buffers;
+        }
+
+        FHoudiniInputMeshStagingBuffers * operator->() const { return Buffers; }
+
+        /** Delete all the buffers which are not borrowed. **/
+        static void FreePool()
+        {
+            FScopeLock ScopeLock( &CriticalSection );
+
+            for ( FHoudiniInputMeshStagingBuffers * FreeBuffer : FreeBuffers )
+                delete FreeBuffer;
+
+            FreeBuffers.Empty();
+        }
+
+    protected:
+
+        /** Borrowed buffers. **/
+        FHoudiniInputMeshStagingBuffers * Buffers;
+
+        /** Synchronization primitive. **/
+        static FCriticalSection CriticalSection;
+
+        /** Buffers which are not borrowed. **/
+        static TArray< FHoudiniInputMeshStagingBuffers * > FreeBuffers;
+};
+
+FCriticalSection
+FHoudiniScopedInputMeshStagingBuffers::CriticalSection;
+
+TArray< FHoudiniInputMeshStagingBuffers * >
+FHoudiniScopedInputMeshStagingBuffers::FreeBuffers;
+
+void
+FHoudiniEngineUtils::FreeInputMeshStagingBuffers()
+{
+    FHoudiniScopedInputMeshStagingBuffers::FreePool();
+}
+
+/** Convert per wedge values into a contiguous buffer of TupleSize components per wedge. If requested, the last **/
+/** two wedges of each triangle are swapped to account for winding differences. **/
+template< typename ElementType, typename OutElementType, typename ConvertFunction >
+static void
+HoudiniStageInputWedges(
+    const ElementType * RESTRICT In, int32 Count, bool bFlipWinding,
+    OutElementType * RESTRICT Out, int32 TupleSize, ConvertFunction Convert )
+{
+    const int32 TriangleCount = bFlipWinding ? Count / 3 : 0;
+    for ( int32 TriangleIdx = 0; TriangleIdx < TriangleCount; ++TriangleIdx )
+    {
+        const ElementType * RESTRICT Triangle = In + TriangleIdx * 3;
+        OutElementType * RESTRICT OutTriangle = Out + TriangleIdx * 3 * TupleSize;
+
+        Convert( Triangle[ 0 ], OutTriangle );
+        Convert( Triangle[ 2 ], OutTriangle + TupleSize );
+        Convert( Triangle[ 1 ], OutTriangle + TupleSize * 2 );
+    }
+
+    for ( int32 Idx = TriangleCount * 3; Idx < Count; ++Idx )
+        Convert( In[ Idx ], Out + Idx * TupleSize );
+}
+
+/** Compute the input mesh cache key of a static mesh. Return false if the mesh cannot be shared between inputs. **/
+static bool
+HoudiniGetInputMeshCacheKey(
+    UStaticMesh * StaticMesh, UStaticMeshComponent * StaticMeshComponent,
+    bool bExportAllLODs, bool bExportSockets, FHoudiniEngineInputMeshCacheKey & Key )
+{
+    // Override vertex colors and attribute data components make the uploaded geometry specific to a component.
+    if ( StaticMeshComponent )
+    {
+        for ( const FStaticMeshComponentLODInfo & LODInfo : StaticMeshComponent->LODData )
+        {
+            if ( LODInfo.OverrideVertexColors )
+                return false;
+        }
+
+        if ( StaticMeshComponent->GetOwner() &&
+            StaticMeshComponent->GetOwner()->FindComponentByClass< UHoudiniAttributeDataComponent >() )
+            return false;
+    }
+
+    Key.MeshPath = StaticMesh->GetPathName();
+    Key.bExportAllLODs = bExportAllLODs && ( StaticMesh->GetNumLODs() > 1 );
+    Key.bExportSockets = bExportSockets && ( StaticMesh->Sockets.Num() > 0 );
+
+    uint32 Hash = 0;
+
+    // Raw mesh ids change whenever the raw mesh data is modified.
+    const int32 NumLODs = Key.bExportAllLODs ? StaticMesh->GetNumLODs() : 1;
+#if WITH_EDITORONLY_DATA
+    for ( int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex )
+    {
+        const FStaticMeshSourceModel & SrcModel = StaticMesh->SourceModels[ LODIndex ];
+        Hash = FCrc::StrCrc32( *SrcModel.RawMeshBulkData->GetIdString(), Hash );
+        Hash = FCrc::MemCrc32( &SrcModel.ScreenSize, sizeof( SrcModel.ScreenSize ), Hash );
+
+        for ( int32 MatIdx = 0; MatIdx < StaticMesh->Materials.Num(); ++MatIdx )
+        {
+            const int32 SectionMatIdx = StaticMesh->SectionInfoMap.Get( LODIndex, MatIdx ).MaterialIndex;
+            Hash = FCrc::MemCrc32( &SectionMatIdx, sizeof( SectionMatIdx ), Hash );
+        }
+    }
+#endif
+
+    for ( UMaterialInterface * Material : StaticMesh->Materials )
+    {
+        if ( Material )
+            Hash = FCrc::StrCrc32( *Material->GetPathName(), Hash );
+    }
+
+    const uint8 bAutoComputeLODScreenSize = StaticMesh->bAutoComputeLODScreenSize ? 1 : 0;
+    Hash = FCrc::MemCrc32( &bAutoComputeLODScreenSize, sizeof( bAutoComputeLODScreenSize ), Hash );
+    Hash = FCrc::MemCrc32( &StaticMesh->LightMapResolution, sizeof( StaticMesh->LightMapResolution ), Hash );
+
+    if ( Key.bExportSockets )
+    {
+        for ( UStaticMeshSocket * Socket : StaticMesh->Sockets )
+        {
+            if ( !Socket )
+                continue;
+
+            Hash = FCrc::StrCrc32( *Socket->SocketName.ToString(), Hash );
+            Hash = FCrc::StrCrc32( *Socket->Tag, Hash );
+            Hash = FCrc::MemCrc32( &Socket->RelativeLocation, sizeof( Socket->RelativeLocation ), Hash );
+            Hash = FCrc::MemCrc32( &Socket->RelativeRotation, sizeof( Socket->RelativeRotation ), Hash );
+            Hash = FCrc::MemCrc32( &Socket->RelativeScale, sizeof( Socket->RelativeScale ), Hash );
+        }
+    }
+
+    // Settings used while marshalling.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+    {
+        const uint8 ImportAxis = HoudiniRuntimeSettings->ImportAxis;
+        Hash = FCrc::MemCrc32( &ImportAxis, sizeof( ImportAxis ), Hash );
+        Hash = FCrc::MemCrc32(
+            &HoudiniRuntimeSettings->GeneratedGeometryScaleFactor,
+            sizeof( HoudiniRuntimeSettings->GeneratedGeometryScaleFactor ), Hash );
+        Hash = FCrc::MemCrc32(
+            &HoudiniRuntimeSettings->LightMapResolution, sizeof( HoudiniRuntimeSettings->LightMapResolution ), Hash );
+        Hash = FCrc::StrCrc32( *HoudiniRuntimeSettings->MarshallingAttributeMaterial, Hash );
+        Hash = FCrc::StrCrc32( *HoudiniRuntimeSettings->MarshallingAttributeFaceSmoothingMask, Hash );
+        Hash = FCrc::StrCrc32( *HoudiniRuntimeSettings->MarshallingAttributeLightmapResolution, Hash );
+        Hash = FCrc::StrCrc32( *HoudiniRuntimeSettings->MarshallingAttributeInputMeshName, Hash );
+        Hash = FCrc::StrCrc32( *HoudiniRuntimeSettings->MarshallingAttributeInputSourceFile, Hash );
+    }
+
+    Key.ContentHash = Hash;
+    return true;
+}
+
+#endif // WITH_EDITOR
+
+bool
+FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
+    UStaticMesh * StaticMesh,
+    HAPI_NodeId & ConnectedAssetId,
+    TArray< HAPI_NodeId >& OutCreatedNodeIds,
+    UStaticMeshComponent* StaticMeshComponent /* = nullptr */,
+    const bool& ExportAllLODs /* = false */,
+    const bool& ExportSockets /* = false */)
+{
+#if WITH_EDITOR
+
+    // If we don't have a static mesh there's nothing to do.
+    if ( !StaticMesh )
+        return false;
+
+    // A mesh cooked by another Houdini asset may still be waiting for its build, its render data is needed.
+    AHoudiniAssetActor * HoudiniAssetActor =
+        StaticMeshComponent ? Cast< AHoudiniAssetActor >( StaticMeshComponent->GetOwner() ) : nullptr;
+    if ( HoudiniAssetActor && HoudiniAssetActor->GetHoudiniAssetComponent() )
+        HoudiniAssetActor->GetHoudiniAssetComponent()->BuildDeferredStaticMesh( StaticMesh );
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    // Inputs which already own a plain input node keep uploading into it.
+    FHoudiniEngineInputMeshCacheKey Key;
+    if ( !HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bShareInputMeshNodes
+        || ( ConnectedAssetId >= 0 && !FHoudiniEngineInputMeshCache::IsReference( ConnectedAssetId ) )
+        || !HoudiniGetInputMeshCacheKey( StaticMesh, StaticMeshComponent, ExportAllLODs, ExportSockets, Key ) )
+    {
+        return HapiUploadStaticMeshInputNode(
+            StaticMesh, ConnectedAssetId, OutCreatedNodeIds, StaticMeshComponent, ExportAllLODs, ExportSockets );
+    }
+
+    // Upload the mesh if no other input did it already.
+    if ( FHoudiniEngineInputMeshCache::FindSharedNode( Key ) < 0 )
+    {
+        HAPI_NodeId SharedNodeId = -1;
+        TArray< HAPI_NodeId > SharedNodeIds;
+        if ( !HapiUploadStaticMeshInputNode(
+            StaticMesh, SharedNodeId, SharedNodeIds, StaticMeshComponent, ExportAllLODs, ExportSockets ) )
+        {
+            for ( HAPI_NodeId NodeId : SharedNodeIds )
+                FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), NodeId );
+
+            return false;
+        }
+
+        if ( !FHoudiniEngineInputMeshCache::AddSharedNode( Key, SharedNodeId, SharedNodeIds ) )
+            return false;
+    }
+
+    return FHoudiniEngineInputMeshCache::CreateReference( Key, ConnectedAssetId, OutCreatedNodeIds );
+
+#else
+
+    return true;
+
+#endif
+}
+
+bool
+FHoudiniEngineUtils::HapiUploadStaticMeshInputNode(
+    UStaticMesh * StaticMesh,
+    HAPI_NodeId & ConnectedAssetId,
+    TArray< HAPI_NodeId >& OutCreatedNodeIds,
+    UStaticMeshComponent* StaticMeshComponent,
+    const bool& ExportAllLODs,
+    const bool& ExportSockets )
+{
+#if WITH_EDITOR
+
+    // If we don't have a static mesh there's nothing to do.
+    if ( !StaticMesh )
+        return false;
+
+    // Export sockets if there are some
+    bool DoExportSockets = ExportSockets && ( StaticMesh->Sockets.Num() > 0 );
+
+    // Export LODs if there are some
+    bool DoExportLODs = ExportAllLODs && ( StaticMesh->GetNumLODs() > 1 );
+
+    // We need to use a merge node if we export lods OR sockets
+    bool UseMergeNode = DoExportLODs || DoExportSockets;
+
+    if ( UseMergeNode )
+    {
+        // Create a merge SOP asset. This will be our "ConnectedAssetId".
+        // All the different LOD meshes will be plugged into it
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+            FHoudiniEngine::Get().GetSession(), -1,
+            "SOP/merge", "input", true, &ConnectedAssetId ), false );
+    }
+    else if ( ConnectedAssetId < 0 )
+    {
+        // No LOD, we need a single input node
+        // If connected asset id is invalid, we need to create an input node.
+        HAPI_NodeId InputNodeId = -1;
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputNode(
+            FHoudiniEngine::Get().GetSession(), &InputNodeId, nullptr ), false );
+
+        // Check if we have a valid id for this new input asset.
+        if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( InputNodeId ) )
+            return false;
+
+        // We now have a valid id.
+        ConnectedAssetId = InputNodeId;
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
+            FHoudiniEngine::Get().GetSession(), InputNodeId, nullptr ), false );
+    }
+
+    // Get the input's parent OBJ node
+    HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId( ConnectedAssetId );
+    OutCreatedNodeIds.AddUnique( ParentId );
+
+    // Get runtime settings.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    check( HoudiniRuntimeSettings );
+
+    float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
+    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
+    int32 GeneratedLightMapResolution = 32;
+
+    if ( HoudiniRuntimeSettings )
+    {
+        GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
+        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
+        GeneratedLightMapResolution = HoudiniRuntimeSettings->LightMapResolution;
+    }
+
+    int32 NumLODsToExport = DoExportLODs ? StaticMesh->GetNumLODs() : 1;
+    for ( int32 LODIndex = 0; LODIndex < NumLODsToExport; LODIndex++ )
+    {
+        // Grab the LOD level.
+#if WITH_EDITORONLY_DATA
+    FStaticMeshSourceModel & SrcModel = StaticMesh->SourceModels[LODIndex];
+
+        // If we're using a merge node, we need to create a new input null
+        HAPI_NodeId CurrentLODNodeId = -1;
+        if ( UseMergeNode )
+        {
+            // Create a new input node for the current LOD
             const char * LODName = "";
             {
                 FString LOD = TEXT( "lod" ) + FString::FromInt( LODIndex );
@@ -2739,6 +3218,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
         SrcModel.RawMeshBulkData->LoadRawMesh( RawMesh );
 #endif
 
+        // Conversion buffers, recycled between LODs and uploads.
+        FHoudiniScopedInputMeshStagingBuffers StagingBuffers;
+
         // Create part.
         HAPI_PartInfo Part;
         FMemory::Memzero< HAPI_PartInfo >( Part );
@@ -2771,37 +3253,41 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint ), false );
 
         // Extract vertices from static mesh.
-        TArray< float > StaticMeshVertices;
-        StaticMeshVertices.SetNumZeroed( RawMesh.VertexPositions.Num() * 3 );
-        for ( int32 VertexIdx = 0; VertexIdx < RawMesh.VertexPositions.Num(); ++VertexIdx )
+        const float ScaleFactor = GeneratedGeometryScaleFactor;
+        StagingBuffers->Floats.SetNumUninitialized( RawMesh.VertexPositions.Num() * 3, false );
+        if ( ImportAxis == HRSAI_Unreal )
         {
-            // Grab vertex at this index.
-            const FVector & PositionVector = RawMesh.VertexPositions[ VertexIdx ];
-
-            if ( ImportAxis == HRSAI_Unreal )
-            {
-                StaticMeshVertices[ VertexIdx * 3 + 0 ] = PositionVector.X / GeneratedGeometryScaleFactor;
-                StaticMeshVertices[ VertexIdx * 3 + 1 ] = PositionVector.Z / GeneratedGeometryScaleFactor;
-                StaticMeshVertices[ VertexIdx * 3 + 2 ] = PositionVector.Y / GeneratedGeometryScaleFactor;
-            }
-            else if ( ImportAxis == HRSAI_Houdini )
-            {
-                StaticMeshVertices[ VertexIdx * 3 + 0 ] = PositionVector.X / GeneratedGeometryScaleFactor;
-                StaticMeshVertices[ VertexIdx * 3 + 1 ] = PositionVector.Y / GeneratedGeometryScaleFactor;
-                StaticMeshVertices[ VertexIdx * 3 + 2 ] = PositionVector.Z / GeneratedGeometryScaleFactor;
-            }
-            else
-            {
-                // Not valid enum value.
-                check( 0 );
-            }
+            HoudiniStageInputWedges(
+                RawMesh.VertexPositions.GetData(), RawMesh.VertexPositions.Num(), false, StagingBuffers->Floats.GetData(), 3,
+                [ ScaleFactor ]( const FVector & Position, float * RESTRICT Out )
+                {
+                    Out[ 0 ] = Position.X / ScaleFactor;
+                    Out[ 1 ] = Position.Z / ScaleFactor;
+                    Out[ 2 ] = Position.Y / ScaleFactor;
+                } );
+        }
+        else if ( ImportAxis == HRSAI_Houdini )
+        {
+            HoudiniStageInputWedges(
+                RawMesh.VertexPositions.GetData(), RawMesh.VertexPositions.Num(), false, StagingBuffers->Floats.GetData(), 3,
+                [ ScaleFactor ]( const FVector & Position, float * RESTRICT Out )
+                {
+                    Out[ 0 ] = Position.X / ScaleFactor;
+                    Out[ 1 ] = Position.Y / ScaleFactor;
+                    Out[ 2 ] = Position.Z / ScaleFactor;
+                } );
+        }
+        else
+        {
+            // Not valid enum value.
+            check( 0 );
         }
 
         // Now that we have raw positions, we can upload them for our attribute.
         HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
             FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
             0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
-            StaticMeshVertices.GetData(), 0,
+            StagingBuffers->Floats.GetData(), 0,
             AttributeInfoPoint.count ), false );
 
         // See if we have texture coordinates to upload.
@@ -2811,32 +3297,19 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
 
             if ( StaticMeshUVCount > 0 )
             {
-                const TArray< FVector2D > & RawMeshUVs = RawMesh.WedgeTexCoords[ MeshTexCoordIdx ];
-                TArray< FVector > StaticMeshUVs;
-                StaticMeshUVs.Reserve( StaticMeshUVCount );
+                check( ImportAxis == HRSAI_Unreal || ImportAxis == HRSAI_Houdini );
 
-                // Transfer UV data.
-                for ( int32 UVIdx = 0; UVIdx < StaticMeshUVCount; ++UVIdx )
-                    StaticMeshUVs.Emplace( RawMeshUVs[ UVIdx ].X, 1.0 - RawMeshUVs[ UVIdx ].Y, 0 );
-
-                if ( ImportAxis == HRSAI_Unreal )
-                {
-                    // We need to re-index UVs for wedges we swapped (due to winding differences).
-                    for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
+                // Transfer UV data, we need to re-index UVs for wedges we swapped (due to winding differences).
+                StagingBuffers->Floats.SetNumUninitialized( StaticMeshUVCount * 3, false );
+                HoudiniStageInputWedges(
+                    RawMesh.WedgeTexCoords[ MeshTexCoordIdx ].GetData(), StaticMeshUVCount, ImportAxis == HRSAI_Unreal,
+                    StagingBuffers->Floats.GetData(), 3,
+                    []( const FVector2D & UV, float * RESTRICT Out )
                     {
-                        // We do not touch wedge 0 of this triangle.
-                        StaticMeshUVs.SwapMemory( WedgeIdx + 1, WedgeIdx + 2 );
-                    }
-                }
-                else if ( ImportAxis == HRSAI_Houdini )
-                {
-                    // Do nothing, data is in proper format.
-                }
-                else
-                {
-                    // Not valid enum value.
-                    check( 0 );
-                }
+                        Out[ 0 ] = UV.X;
+                        Out[ 1 ] = 1.0f - UV.Y;
+                        Out[ 2 ] = 0.0f;
+                    } );
 
                 // Construct attribute name for this index.
                 FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
@@ -2861,33 +3334,33 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                 HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
                     FHoudiniEngine::Get().GetSession(),
                     CurrentLODNodeId, 0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex,
-                    (const float *) StaticMeshUVs.GetData(), 0, AttributeInfoVertex.count ), false );
+                    StagingBuffers->Floats.GetData(), 0, AttributeInfoVertex.count ), false );
             }
         }
 
         // See if we have normals to upload.
         if ( RawMesh.WedgeTangentZ.Num() > 0 )
         {
-            TArray< FVector > ChangedNormals( RawMesh.WedgeTangentZ );
+            const float * NormalData = (const float *) RawMesh.WedgeTangentZ.GetData();
 
             if ( ImportAxis == HRSAI_Unreal )
             {
                 // We need to re-index normals for wedges we swapped (due to winding differences).
-                for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-                {
-                    FVector TangentZ1 = ChangedNormals[ WedgeIdx + 1 ];
-                FVector TangentZ2 = ChangedNormals[ WedgeIdx + 2 ];
-
-                    ChangedNormals[ WedgeIdx + 1 ] = TangentZ2;
-                    ChangedNormals[ WedgeIdx + 2 ] = TangentZ1;
-                }
+                StagingBuffers->Floats.SetNumUninitialized( RawMesh.WedgeTangentZ.Num() * 3, false );
+                HoudiniStageInputWedges(
+                    RawMesh.WedgeTangentZ.GetData(), RawMesh.WedgeTangentZ.Num(), true, StagingBuffers->Floats.GetData(), 3,
+                    []( const FVector & Normal, float * RESTRICT Out )
+                    {
+                        Out[ 0 ] = Normal.X;
+                        Out[ 1 ] = Normal.Z;
+                        Out[ 2 ] = Normal.Y;
+                    } );
 
-                for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); ++WedgeIdx )
-                    Swap( ChangedNormals[ WedgeIdx ].Y, ChangedNormals[ WedgeIdx ].Z );
+                NormalData = StagingBuffers->Floats.GetData();
             }
             else if ( ImportAxis == HRSAI_Houdini )
             {
-                // Do nothing, data is in proper format.
+                // Do nothing, data is in proper format and can be uploaded directly.
             }
             else
             {
@@ -2898,7 +3371,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             // Create attribute for normals.
             HAPI_AttributeInfo AttributeInfoVertex;
             FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoVertex );
-            AttributeInfoVertex.count = ChangedNormals.Num();
+            AttributeInfoVertex.count = RawMesh.WedgeTangentZ.Num();
             AttributeInfoVertex.tupleSize = 3;
             AttributeInfoVertex.exists = true;
             AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
@@ -2912,14 +3385,12 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
                 FHoudiniEngine::Get().GetSession(),
                 CurrentLODNodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex,
-                (const float *) ChangedNormals.GetData(),
-                0, AttributeInfoVertex.count ), false );
+                NormalData, 0, AttributeInfoVertex.count ), false );
         }
 
         {
             // If we have instance override vertex colors, first propagate them to our copy of 
             // the RawMesh Vert Colors
-            TArray< FLinearColor > ChangedColors;
             if ( StaticMeshComponent &&
                 StaticMeshComponent->LODData.IsValidIndex( LODIndex ) &&
                 StaticMeshComponent->LODData[LODIndex].OverrideVertexColors &&
@@ -2964,38 +3435,26 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             // See if we have colors to upload.
             if ( RawMesh.WedgeColors.Num() > 0 )
             {
-                ChangedColors.SetNumUninitialized( RawMesh.WedgeColors.Num() );
+                check( ImportAxis == HRSAI_Unreal || ImportAxis == HRSAI_Houdini );
 
-                if ( ImportAxis == HRSAI_Unreal )
-                {
-                    // We need to re-index colors for wedges we swapped (due to winding differences).
-                    for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-                    {
-                        ChangedColors[WedgeIdx + 0] = RawMesh.WedgeColors[WedgeIdx + 0].ReinterpretAsLinear();
-                        ChangedColors[WedgeIdx + 1] = RawMesh.WedgeColors[WedgeIdx + 2].ReinterpretAsLinear();
-                        ChangedColors[WedgeIdx + 2] = RawMesh.WedgeColors[WedgeIdx + 1].ReinterpretAsLinear();
-                    }
-                }
-                else if ( ImportAxis == HRSAI_Houdini )
-                {
-                    for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); ++WedgeIdx )
+                // We need to re-index colors for wedges we swapped (due to winding differences).
+                StagingBuffers->Floats.SetNumUninitialized( RawMesh.WedgeColors.Num() * 4, false );
+                HoudiniStageInputWedges(
+                    RawMesh.WedgeColors.GetData(), RawMesh.WedgeColors.Num(), ImportAxis == HRSAI_Unreal,
+                    StagingBuffers->Floats.GetData(), 4,
+                    []( const FColor & Color, float * RESTRICT Out )
                     {
-                        ChangedColors[WedgeIdx] = RawMesh.WedgeColors[WedgeIdx].ReinterpretAsLinear();
-                    }
-                }
-                else
-                {
-                    // Not valid enum value.
-                    check( 0 );
-                }
-            }
+                        static const float OneOver255 = 1.0f / 255.0f;
+                        Out[ 0 ] = Color.R * OneOver255;
+                        Out[ 1 ] = Color.G * OneOver255;
+                        Out[ 2 ] = Color.B * OneOver255;
+                        Out[ 3 ] = Color.A * OneOver255;
+                    } );
 
-            if ( ChangedColors.Num() > 0 )
-            {
                 // Create attribute for colors.
                 HAPI_AttributeInfo AttributeInfoVertex;
                 FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoVertex );
-                AttributeInfoVertex.count = ChangedColors.Num();
+                AttributeInfoVertex.count = RawMesh.WedgeColors.Num();
                 AttributeInfoVertex.tupleSize = 4;
                 AttributeInfoVertex.exists = true;
                 AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
@@ -3009,47 +3468,35 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                 HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
                     FHoudiniEngine::Get().GetSession(),
                     CurrentLODNodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex,
-                    (const float *)ChangedColors.GetData(), 0, AttributeInfoVertex.count ), false );
+                    StagingBuffers->Floats.GetData(), 0, AttributeInfoVertex.count ), false );
             }
         }
 
         // Extract indices from static mesh.
         if ( RawMesh.WedgeIndices.Num() > 0 )
         {
-            TArray< int32 > StaticMeshIndices;
-            StaticMeshIndices.SetNumUninitialized( RawMesh.WedgeIndices.Num() );
+            check( ImportAxis == HRSAI_Unreal || ImportAxis == HRSAI_Houdini );
 
-            if ( ImportAxis == HRSAI_Unreal )
-            {
-                for ( int32 IndexIdx = 0; IndexIdx < RawMesh.WedgeIndices.Num(); IndexIdx += 3 )
-                {
-                    // Swap indices to fix winding order.
-                    StaticMeshIndices[ IndexIdx + 0 ] = RawMesh.WedgeIndices[ IndexIdx + 0 ];
-                    StaticMeshIndices[ IndexIdx + 1 ] = RawMesh.WedgeIndices[ IndexIdx + 2 ];
-                    StaticMeshIndices[ IndexIdx + 2 ] = RawMesh.WedgeIndices[ IndexIdx + 1 ];
-                }
-            }
-            else if ( ImportAxis == HRSAI_Houdini )
-            {
-                StaticMeshIndices = TArray< int32 >( RawMesh.WedgeIndices );
-            }
-            else
-            {
-                // Not valid enum value.
-                check( 0 );
-            }
+            // Swap indices to fix winding order.
+            StagingBuffers->Indices.SetNumUninitialized( RawMesh.WedgeIndices.Num(), false );
+            HoudiniStageInputWedges(
+                RawMesh.WedgeIndices.GetData(), RawMesh.WedgeIndices.Num(), ImportAxis == HRSAI_Unreal,
+                StagingBuffers->Indices.GetData(), 1,
+                []( uint32 Index, int32 * RESTRICT Out ) { Out[ 0 ] = (int32) Index; } );
 
             // We can now set vertex list.
             HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVertexList(
                 FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
-                0, StaticMeshIndices.GetData(), 0, StaticMeshIndices.Num() ), false );
+                0, StagingBuffers->Indices.GetData(), 0, StagingBuffers->Indices.Num() ), false );
+
+            // We need to generate array of face counts, it only needs to grow as all faces are triangles.
+            TArray< int32 > & StaticMeshFaceCounts = StagingBuffers->FaceCounts;
+            if ( StaticMeshFaceCounts.Num() < Part.faceCount )
+                StaticMeshFaceCounts.Init( 3, Part.faceCount );
 
-            // We need to generate array of face counts.
-            TArray< int32 > StaticMeshFaceCounts;
-            StaticMeshFaceCounts.Init( 3, Part.faceCount );
             HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetFaceCounts(
                 FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
-                0, StaticMeshFaceCounts.GetData(), 0, StaticMeshFaceCounts.Num() ), false );
+                0, StaticMeshFaceCounts.GetData(), 0, Part.faceCount ), false );
         }
 
         // Marshall face material indices.
@@ -3187,12 +3634,8 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             const FString MeshAssetPath = StaticMesh->GetPathName();
             std::string MeshAssetPathCStr = TCHAR_TO_ANSI( *MeshAssetPath );
             const char* MeshAssetPathRaw = MeshAssetPathCStr.c_str();
-            TArray<const char*> PrimitiveAttrs;
-            PrimitiveAttrs.AddUninitialized( Part.faceCount );
-            for ( int32 Ix = 0; Ix < Part.faceCount; ++Ix )
-            {
-                PrimitiveAttrs[ Ix ] = MeshAssetPathRaw;
-            }
+            TArray<const char*> & PrimitiveAttrs = StagingBuffers->Strings;
+            PrimitiveAttrs.Init( MeshAssetPathRaw, Part.faceCount );
 
             std::string MarshallingAttributeName;
             FHoudiniEngineUtils::ConvertUnrealString(
@@ -3239,12 +3682,8 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             {
                 std::string FilenameCStr = TCHAR_TO_ANSI( *Filename );
                 const char* FilenameCStrRaw = FilenameCStr.c_str();
-                TArray<const char*> PrimitiveAttrs;
-                PrimitiveAttrs.AddUninitialized( Part.faceCount );
-                for( int32 Ix = 0; Ix < Part.faceCount; ++Ix )
-                {
-                    PrimitiveAttrs[Ix] = FilenameCStrRaw;
-                }
+                TArray<const char*> & PrimitiveAttrs = StagingBuffers->Strings;
+                PrimitiveAttrs.Init( FilenameCStrRaw, Part.faceCount );
 
                 std::string MarshallingAttributeName;
                 FHoudiniEngineUtils::ConvertUnrealString(
@@ -3884,6 +4323,463 @@ FHoudiniEngineUtils::HapiSetAssetTransform( HAPI_NodeId AssetId, const FTransfor
     return true;
 }
 
+#if WITH_EDITOR
+
+/** Attribute data of a part, fetched once and shared by the raw mesh builds of all its split groups. **/
+struct FHoudiniPartRawMeshData
+{
+    FHoudiniPartRawMeshData()
+        : ImportAxis( HRSAI_Unreal )
+        , GeneratedGeometryScaleFactor( HAPI_UNREAL_SCALE_FACTOR_POSITION )
+        , bReadNormals( true )
+        , bRecomputeTangents( false )
+    {
+        FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoPositions );
+        FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoNormals );
+        FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoColors );
+        FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoAlpha );
+        FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoFaceSmoothingMasks );
+
+        UVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
+        AttribInfoUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
+    }
+
+    /** Assemble the raw mesh of a split group. This does not call into HAPI and is safe to run on any thread.
+        Returns false if the split group only contains degenerate triangles. **/
+    bool BuildRawMesh(
+        const TArray< int32 > & SplitGroupVertexList, int32 SplitGroupVertexListCount,
+        int32 SplitGroupFaceCount, FRawMesh & RawMesh, int32 & LightMapUVChannel ) const;
+
+    /** Hash of the fetched buffers and import settings the raw meshes are built from. **/
+    uint32 GetContentHash() const;
+
+    /** Vertex positions. **/
+    TArray< float > Positions;
+    HAPI_AttributeInfo AttribInfoPositions;
+
+    /** Vertex normals. **/
+    TArray< float > Normals;
+    HAPI_AttributeInfo AttribInfoNormals;
+
+    /** Vertex colors. **/
+    TArray< float > Colors;
+    HAPI_AttributeInfo AttribInfoColors;
+
+    /** Vertex alpha values. **/
+    TArray< float > Alphas;
+    HAPI_AttributeInfo AttribInfoAlpha;
+
+    /** Face smoothing masks. **/
+    TArray< int32 > FaceSmoothingMasks;
+    HAPI_AttributeInfo AttribInfoFaceSmoothingMasks;
+
+    /** UV sets. **/
+    TArray< TArray< float > > UVs;
+    TArray< HAPI_AttributeInfo > AttribInfoUVs;
+
+    /** Import settings. **/
+    EHoudiniRuntimeSettingsAxisImport ImportAxis;
+    float GeneratedGeometryScaleFactor;
+    bool bReadNormals;
+    bool bRecomputeTangents;
+};
+
+/** Raw mesh assembled for a split group. **/
+struct FHoudiniSplitRawMesh
+{
+    FHoudiniSplitRawMesh()
+        : LightMapUVChannel( 0 )
+        , bIsValid( false )
+    {}
+
+    FRawMesh RawMesh;
+    int32 LightMapUVChannel;
+
+    /** False if the split was skipped or only contains degenerate triangles. **/
+    bool bIsValid;
+};
+
+/** Accumulate the CRC of an array's size and content. **/
+template< typename ElementType >
+static uint32
+HoudiniContentHashArray( const TArray< ElementType > & Array, uint32 Crc )
+{
+    const int32 Num = Array.Num();
+    Crc = FCrc::MemCrc32( &Num, sizeof( Num ), Crc );
+    return Num > 0 ? FCrc::MemCrc32( Array.GetData(), Num * sizeof( ElementType ), Crc ) : Crc;
+}
+
+static uint32
+HoudiniContentHashString( const FString & String, uint32 Crc )
+{
+    return FCrc::MemCrc32( *String, ( String.Len() + 1 ) * sizeof( TCHAR ), Crc );
+}
+
+static uint32
+HoudiniContentHashStrings( const TArray< FString > & Strings, uint32 Crc )
+{
+    const int32 Num = Strings.Num();
+    Crc = FCrc::MemCrc32( &Num, sizeof( Num ), Crc );
+    for ( int32 Idx = 0; Idx < Num; ++Idx )
+        Crc = HoudiniContentHashString( Strings[ Idx ], Crc );
+
+    return Crc;
+}
+
+static uint32
+HoudiniContentHashAttributeInfo( const HAPI_AttributeInfo & AttribInfo, uint32 Crc )
+{
+    const int32 Layout[ 4 ] = { AttribInfo.exists, AttribInfo.owner, AttribInfo.tupleSize, AttribInfo.count };
+    return FCrc::MemCrc32( Layout, sizeof( Layout ), Crc );
+}
+
+uint32
+FHoudiniPartRawMeshData::GetContentHash() const
+{
+    uint32 Crc = 0;
+
+    Crc = HoudiniContentHashAttributeInfo( AttribInfoPositions, HoudiniContentHashArray( Positions, Crc ) );
+    Crc = HoudiniContentHashAttributeInfo( AttribInfoNormals, HoudiniContentHashArray( Normals, Crc ) );
+    Crc = HoudiniContentHashAttributeInfo( AttribInfoColors, HoudiniContentHashArray( Colors, Crc ) );
+    Crc = HoudiniContentHashAttributeInfo( AttribInfoAlpha, HoudiniContentHashArray( Alphas, Crc ) );
+    Crc = HoudiniContentHashAttributeInfo(
+        AttribInfoFaceSmoothingMasks, HoudiniContentHashArray( FaceSmoothingMasks, Crc ) );
+
+    for ( int32 TexCoordIdx = 0; TexCoordIdx < UVs.Num(); ++TexCoordIdx )
+        Crc = HoudiniContentHashAttributeInfo( AttribInfoUVs[ TexCoordIdx ], HoudiniContentHashArray( UVs[ TexCoordIdx ], Crc ) );
+
+    const int32 Settings[ 3 ] = { (int32) ImportAxis, bReadNormals, bRecomputeTangents };
+    Crc = FCrc::MemCrc32( Settings, sizeof( Settings ), Crc );
+    return FCrc::MemCrc32( &GeneratedGeometryScaleFactor, sizeof( GeneratedGeometryScaleFactor ), Crc );
+}
+
+bool
+FHoudiniPartRawMeshData::BuildRawMesh(
+    const TArray< int32 > & SplitGroupVertexList, int32 SplitGroupVertexListCount,
+    int32 SplitGroupFaceCount, FRawMesh & RawMesh, int32 & LightMapUVChannel ) const
+{
+    //---------------------------------------------------------------------------------------------------------------------
+    // NORMALS
+    //---------------------------------------------------------------------------------------------------------------------
+    TArray< float > SplitGroupNormals;
+
+    if ( bReadNormals )
+    {
+        // See if we need to transfer normal point attributes to vertex attributes.
+        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+            SplitGroupVertexList, AttribInfoNormals, Normals, SplitGroupNormals );
+    }
+
+    // See if we need to generate tangents, we do this only if normals are present, and if we do not recompute them after
+    bool bGenerateTangents = ( SplitGroupNormals.Num() > 0 ) && !bRecomputeTangents;
+
+    // Transfer normals.
+    int32 WedgeNormalCount = SplitGroupNormals.Num() / 3;
+    RawMesh.WedgeTangentZ.SetNumZeroed( WedgeNormalCount );
+    for ( int32 WedgeTangentZIdx = 0; WedgeTangentZIdx < WedgeNormalCount; ++WedgeTangentZIdx )
+    {
+        FVector WedgeTangentZ;
+        WedgeTangentZ.X = SplitGroupNormals[ WedgeTangentZIdx * 3 + 0 ];
+        if ( ImportAxis == HRSAI_Unreal )
+        {
+            // We need to flip Z and Y coordinate
+            WedgeTangentZ.Y = SplitGroupNormals[ WedgeTangentZIdx * 3 + 2 ];
+            WedgeTangentZ.Z = SplitGroupNormals[ WedgeTangentZIdx * 3 + 1 ];
+        }
+        else
+        {
+            WedgeTangentZ.Y = SplitGroupNormals[ WedgeTangentZIdx * 3 + 1 ];
+            WedgeTangentZ.Z = SplitGroupNormals[ WedgeTangentZIdx * 3 + 2 ];
+        }
+
+        RawMesh.WedgeTangentZ[ WedgeTangentZIdx ] = WedgeTangentZ;
+
+        // If we need to generate tangents.
+        if ( bGenerateTangents )
+        {
+            FVector TangentX, TangentY;
+            WedgeTangentZ.FindBestAxisVectors( TangentX, TangentY );
+
+            RawMesh.WedgeTangentX.Add( TangentX );
+            RawMesh.WedgeTangentY.Add( TangentY );
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //	VERTEX COLORS AND ALPHAS
+    //---------------------------------------------------------------------------------------------------------------------
+    TArray< float > SplitGroupColors;
+
+    // See if we need to transfer color point attributes to vertex attributes.
+    FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+        SplitGroupVertexList, AttribInfoColors, Colors, SplitGroupColors );
+
+    TArray< float > SplitGroupAlphas;
+
+    // See if we need to transfer alpha point attributes to vertex attributes.
+    FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+        SplitGroupVertexList, AttribInfoAlpha, Alphas, SplitGroupAlphas );
+
+    // Transfer colors and alphas to the raw mesh
+    if ( AttribInfoColors.exists && ( AttribInfoColors.tupleSize > 0 ) )
+    {
+        int32 WedgeColorsCount = SplitGroupColors.Num() / AttribInfoColors.tupleSize;
+        RawMesh.WedgeColors.SetNumZeroed( WedgeColorsCount );
+        for ( int32 WedgeColorIdx = 0; WedgeColorIdx < WedgeColorsCount; ++WedgeColorIdx )
+        {
+            FLinearColor WedgeColor;
+            WedgeColor.R = FMath::Clamp(
+                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 0 ], 0.0f, 1.0f );
+            WedgeColor.G = FMath::Clamp(
+                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 1 ], 0.0f, 1.0f );
+            WedgeColor.B = FMath::Clamp(
+                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 2 ], 0.0f, 1.0f );
+
+            if( AttribInfoAlpha.exists )
+            {
+                WedgeColor.A = FMath::Clamp( SplitGroupAlphas[ WedgeColorIdx ], 0.0f, 1.0f );
+            }
+            else if ( AttribInfoColors.tupleSize == 4 )
+            {
+                // We have alpha.
+                WedgeColor.A = FMath::Clamp(
+                    SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 3 ], 0.0f, 1.0f );
+            }
+            else
+            {
+                WedgeColor.A = 1.0f;
+            }
+
+            // Convert linear color to fixed color.
+            RawMesh.WedgeColors[ WedgeColorIdx ] = WedgeColor.ToFColor( false );
+        }
+    }
+    else
+    {
+        // No Colors or Alphas, init colors to White
+        FColor DefaultWedgeColor = FLinearColor::White.ToFColor( false );
+        int32 WedgeColorsCount = RawMesh.WedgeIndices.Num();
+        if ( WedgeColorsCount > 0 )
+            RawMesh.WedgeColors.Init( DefaultWedgeColor, WedgeColorsCount );
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //	FACE SMOOTHING
+    //---------------------------------------------------------------------------------------------------------------------
+
+    // Set face smoothing masks.
+    RawMesh.FaceSmoothingMasks.SetNumZeroed( SplitGroupFaceCount );
+    if ( FaceSmoothingMasks.Num() )
+    {
+        int32 ValidFaceIdx = 0;
+        for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx += 3 )
+        {
+            int32 WedgeCheck = SplitGroupVertexList[ VertexIdx + 0 ];
+            if ( WedgeCheck == -1 )
+                continue;
+
+            RawMesh.FaceSmoothingMasks[ ValidFaceIdx ] = FaceSmoothingMasks[ VertexIdx / 3 ];
+            ValidFaceIdx++;
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //	UVS
+    //---------------------------------------------------------------------------------------------------------------------
+
+    // Extract all UV sets
+    TArray< TArray< float > > SplitGroupUVs;
+    SplitGroupUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
+
+    // See if we need to transfer uv point attributes to vertex attributes.
+    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
+    {
+        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
+            SplitGroupVertexList, AttribInfoUVs[ TexCoordIdx ], UVs[ TexCoordIdx ], SplitGroupUVs[ TexCoordIdx ] );
+    }
+
+    // Transfer UVs to the Raw Mesh
+    int32 UVChannelCount = 0;
+    LightMapUVChannel = 0;
+    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
+    {
+        TArray< float > & TextureCoordinate = SplitGroupUVs[ TexCoordIdx ];
+        if ( TextureCoordinate.Num() > 0 )
+        {
+            int32 WedgeUVCount = TextureCoordinate.Num() / 2;
+            RawMesh.WedgeTexCoords[ TexCoordIdx ].SetNumZeroed( WedgeUVCount );
+            for ( int32 WedgeUVIdx = 0; WedgeUVIdx < WedgeUVCount; ++WedgeUVIdx )
+            {
+                // We need to flip V coordinate when it's coming from HAPI.
+                FVector2D WedgeUV;
+                WedgeUV.X = TextureCoordinate[ WedgeUVIdx * 2 + 0 ];
+                WedgeUV.Y = 1.0f - TextureCoordinate[ WedgeUVIdx * 2 + 1 ];
+
+                RawMesh.WedgeTexCoords[ TexCoordIdx ][ WedgeUVIdx ] = WedgeUV;
+            }
+
+            UVChannelCount++;
+
+            if ( UVChannelCount <= 2 )
+                LightMapUVChannel = TexCoordIdx;
+        }
+        else
+        {
+            RawMesh.WedgeTexCoords[ TexCoordIdx ].Empty();
+        }
+    }
+
+    // We have to have at least one UV channel. If there's none, create one with zero data.
+    if ( UVChannelCount == 0 )
+        RawMesh.WedgeTexCoords[ 0 ].SetNumZeroed( SplitGroupVertexListCount );
+
+    // The lightmap coordinate index is assigned on the static mesh by the caller.
+    // If we have more than one UV set, the 2nd set will be used for lightmaps by convention
+    // If not, the first UV set will be used
+
+    //---------------------------------------------------------------------------------------------------------------------
+    //	INDICES
+    //---------------------------------------------------------------------------------------------------------------------
+
+    //
+    // Because of the splits, we don't need to declare all the vertices in the Part,
+    // but only the one that are currently used by the split's faces.
+    // The indicesMapper array is used to map those indices from Part Vertices to Split Vertices.
+    // We also keep track of the needed vertices index to declare them easily afterwards.
+    //
+
+    // IndicesMapper:
+    // Maps index values for all vertices in the Part:
+    // - Vertices unused by the split will be set to -1
+    // - Used vertices will have their value set to the "NewIndex"
+    // So that IndicesMapper[ oldIndex ] => newIndex
+    TArray< int32 > IndicesMapper;
+    IndicesMapper.Init( -1, SplitGroupVertexList.Num() );
+    int32 CurrentMapperIndex = 0;
+
+    // Neededvertices:
+    // Contains the old index of the needed vertices for the current split
+    // NeededVertices[ newIndex ] => oldIndex
+    TArray< int32 > NeededVertices;
+
+    RawMesh.WedgeIndices.SetNumZeroed( SplitGroupVertexListCount );
+    int32 ValidVertexId = 0;
+    for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx += 3 )
+    {
+        int32 WedgeCheck = SplitGroupVertexList[ VertexIdx + 0 ];
+        if ( WedgeCheck == -1 )
+            continue;
+
+        int32 WedgeIndices[ 3 ] =
+        {
+            SplitGroupVertexList[ VertexIdx + 0 ],
+            SplitGroupVertexList[ VertexIdx + 1 ],
+            SplitGroupVertexList[ VertexIdx + 2 ]
+        };
+
+        // Converting Old (Part) Indices to New (Split) Indices:
+        for ( int32 i = 0; i < 3; i++ )
+        {
+            if ( IndicesMapper[ WedgeIndices[ i ] ] < 0 )
+            {
+                // This old index was not yet "converted" to a new index
+                NeededVertices.Add( WedgeIndices[ i ] );
+
+                IndicesMapper[ WedgeIndices[ i ] ] = CurrentMapperIndex;
+                CurrentMapperIndex++;
+            }
+
+            // Replace the old index with the new one
+            WedgeIndices[ i ] = IndicesMapper[ WedgeIndices[ i ] ];
+        }
+
+        if ( ValidVertexId >= SplitGroupVertexListCount )
+            continue;
+
+        if ( ImportAxis == HRSAI_Unreal )
+        {
+            // Flip wedge indices to fix the winding order.
+            RawMesh.WedgeIndices[ ValidVertexId + 0 ] = WedgeIndices[ 0 ];
+            RawMesh.WedgeIndices[ ValidVertexId + 1 ] = WedgeIndices[ 2 ];
+            RawMesh.WedgeIndices[ ValidVertexId + 2 ] = WedgeIndices[ 1 ];
+
+            // Check if we need to patch UVs.
+            for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
+            {
+                if ( RawMesh.WedgeTexCoords[ TexCoordIdx ].Num() > 0
+                    && ( (ValidVertexId + 2) < RawMesh.WedgeTexCoords[ TexCoordIdx ].Num() ) )
+                {
+                    Swap( RawMesh.WedgeTexCoords[ TexCoordIdx ][ ValidVertexId + 1 ],
+                        RawMesh.WedgeTexCoords[ TexCoordIdx ][ ValidVertexId + 2 ] );
+                }
+            }
+
+            // Check if we need to patch colors.
+            if ( RawMesh.WedgeColors.Num() > 0 )
+                Swap( RawMesh.WedgeColors[ ValidVertexId + 1 ], RawMesh.WedgeColors[ ValidVertexId + 2 ] );
+
+            // Check if we need to patch Normals and tangents.
+            if ( RawMesh.WedgeTangentZ.Num() > 0 )
+                Swap( RawMesh.WedgeTangentZ[ ValidVertexId + 1 ], RawMesh.WedgeTangentZ[ ValidVertexId + 2 ] );
+
+            if ( RawMesh.WedgeTangentX.Num() > 0 )
+                Swap( RawMesh.WedgeTangentX[ ValidVertexId + 1 ], RawMesh.WedgeTangentX[ ValidVertexId + 2 ] );
+
+            if ( RawMesh.WedgeTangentY.Num() > 0 )
+                Swap ( RawMesh.WedgeTangentY[ ValidVertexId + 1 ], RawMesh.WedgeTangentY[ ValidVertexId + 2 ] );
+        }
+        else if ( ImportAxis == HRSAI_Houdini )
+        {
+            // Dont flip the wedge indices
+            RawMesh.WedgeIndices[ ValidVertexId + 0 ] = WedgeIndices[ 0 ];
+            RawMesh.WedgeIndices[ ValidVertexId + 1 ] = WedgeIndices[ 1 ];
+            RawMesh.WedgeIndices[ ValidVertexId + 2 ] = WedgeIndices[ 2 ];
+        }
+
+        ValidVertexId += 3;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------
+    // POSITIONS
+    //---------------------------------------------------------------------------------------------------------------------
+
+    //
+    // Transfer vertex positions:
+    //
+    // Because of the split, we're only interested in the needed vertices.
+    // Instead of declaring all the Positions, we'll only declare the vertices
+    // needed by the current split.
+    //
+    int32 VertexPositionsCount = NeededVertices.Num();
+    RawMesh.VertexPositions.SetNumZeroed( VertexPositionsCount );
+    for ( int32 VertexPositionIdx = 0; VertexPositionIdx < VertexPositionsCount; ++VertexPositionIdx )
+    {
+        int32 NeededVertexIndex = NeededVertices[ VertexPositionIdx ];
+
+        FVector VertexPosition;
+        VertexPosition.X = Positions[ NeededVertexIndex * 3 + 0 ] * GeneratedGeometryScaleFactor;
+        if ( ImportAxis == HRSAI_Unreal )
+        {
+            // We need to swap Z and Y coordinate here.
+            VertexPosition.Y = Positions[ NeededVertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
+            VertexPosition.Z = Positions[ NeededVertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
+        }
+        else if ( ImportAxis == HRSAI_Houdini )
+        {
+            // No swap required.
+            VertexPosition.Y = Positions[ NeededVertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
+            VertexPosition.Z = Positions[ NeededVertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
+        }
+
+        RawMesh.VertexPositions[ VertexPositionIdx ] = VertexPosition;
+    }
+
+    // We need to check if this mesh contains only degenerate triangles.
+    return FHoudiniEngineUtils::CountDegenerateTriangles( RawMesh ) != SplitGroupFaceCount;
+}
+
+#endif // WITH_EDITOR
+
 bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
     HAPI_NodeId AssetId,
     FHoudiniCookParams& HoudiniCookParams,
@@ -3900,6 +4796,18 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
     // Make sure rendering is done - so we are not changing data being used by collision drawing.
     FlushRenderingCommands();
 
+    // Attribute directories from a previous cook may no longer be valid, strings are cached for this pass only.
+    FHoudiniEngineStringCacheScope StringCacheScope;
+    FHoudiniEngineAttributeDirectory::Reset();
+
+    // Content hashes of the meshes built by the previous cook, unchanged splits can keep their mesh.
+    TMap< FHoudiniGeoPartObject, uint32 > PreviousContentHashes;
+    for ( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TConstIterator Iter( StaticMeshesIn ); Iter; ++Iter )
+    {
+        if ( Iter.Key().ContentHash != 0 && Iter.Value() )
+            PreviousContentHashes.Add( Iter.Key(), Iter.Key().ContentHash );
+    }
+
     // Get runtime settings.
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
     check( HoudiniRuntimeSettings );
@@ -4348,42 +5256,20 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
             // Containers used for raw data extraction.
 
-            // Vertex Positions
-            TArray< float > PartPositions;
-            HAPI_AttributeInfo AttribInfoPositions;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoPositions );
-
-            // Vertex Normals
-            TArray< float > PartNormals;
-            HAPI_AttributeInfo AttribInfoNormals;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoNormals );
+            // Positions, normals, colors, alphas, smoothing masks and UVs, shared by all the split groups.
+            FHoudiniPartRawMeshData PartRawMeshData;
+            PartRawMeshData.ImportAxis = ImportAxis;
+            PartRawMeshData.GeneratedGeometryScaleFactor = GeneratedGeometryScaleFactor;
 
-            // Vertex Colors
-            TArray< float > PartColors;
-            HAPI_AttributeInfo AttribInfoColors;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoColors );
-
-            // Vertex Alpha values
-            TArray< float > PartAlphas;
-            HAPI_AttributeInfo AttribInfoAlpha;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoAlpha );
-
-            // UVs
-            TArray< TArray< float > > PartUVs;
-            PartUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
-            TArray< HAPI_AttributeInfo > AttribInfoUVs;
-            AttribInfoUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
+            // No need to read the normals or generate tangents if we'll recompute them after
+            PartRawMeshData.bReadNormals = HoudiniRuntimeSettings->RecomputeNormalsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;
+            PartRawMeshData.bRecomputeTangents = HoudiniRuntimeSettings->RecomputeTangentsFlag == EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;
 
             // Material Overrides per face
             TArray< FString > PartFaceMaterialAttributeOverrides;
             HAPI_AttributeInfo AttribFaceMaterials;
             FMemory::Memzero< HAPI_AttributeInfo >( AttribFaceMaterials );
 
-            // Face Smoothing masks
-            TArray< int32 > PartFaceSmoothingMasks;
-            HAPI_AttributeInfo AttribInfoFaceSmoothingMasks;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoFaceSmoothingMasks );
-
             // Lightmap resolution
             TArray< int32 > PartLightMapResolutions;
             HAPI_AttributeInfo AttribLightmapResolution;
@@ -4467,7 +5353,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
             bool bRequireSplit = SplitGroupNames.Num() > 0;
 
-            TMap< FString, TArray< int32 > > GroupSplitFaces;
+            // Splits only keep the list of their faces, their vertex lists are expanded when their mesh is built.
             TMap< FString, int32 > GroupSplitFaceCounts;
             TMap< FString, TArray< int32 > > GroupSplitFaceIndices;
 
@@ -4476,15 +5362,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
             if ( bRequireSplit )
             {
-                // Buffer for all vertex indices used for split groups.
-                // We need this to figure out all vertex indices that are not part of them. 
-                TArray< int32 > AllSplitVertexList;
-                AllSplitVertexList.SetNumZeroed( PartVertexList.Num() );
-
-                // Buffer for all face indices used for split groups.
-                // We need this to figure out all face indices that are not part of them.
-                TArray< int32 > AllSplitFaceIndices;
-                AllSplitFaceIndices.SetNumZeroed( PartFaceMaterialIds.Num() );
+                // Faces owned by split groups.
+                // We need this to figure out all faces that are not part of them.
+                TBitArray<> AllSplitFaces( false, PartVertexList.Num() / 3 );
 
                 // Some of the groups may contain invalid geometry 
                 // Store them here so we can remove them afterwards
@@ -4495,14 +5375,12 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 {
                     FString GroupName = SplitGroupNames[ SplitIdx ];
 
-                    // New vertex list just for this group.
-                    TArray< int32 > GroupVertexList;
+                    // Face list just for this group.
                     TArray< int32 > AllFaceList;
 
-                    // Extract vertex indices for this split.
-                    GroupVertexListCount = FHoudiniEngineUtils::HapiGetVertexListForGroup(
-                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id, GroupName, PartVertexList, GroupVertexList,
-                        AllSplitVertexList, AllFaceList, AllSplitFaceIndices, PartInfo.isInstanced );
+                    // Extract faces for this split.
+                    GroupVertexListCount = FHoudiniEngineUtils::HapiGetFaceListForGroup(
+                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id, GroupName, AllFaceList, AllSplitFaces );
 
                     if ( GroupVertexListCount <= 0 )
                     {
@@ -4518,9 +5396,8 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     }
 
                     // If list is not empty, we store it for this group - this will define new mesh.
-                    GroupSplitFaces.Add( GroupName, GroupVertexList );
                     GroupSplitFaceCounts.Add( GroupName, GroupVertexListCount );
-                    GroupSplitFaceIndices.Add( GroupName, AllFaceList );
+                    GroupSplitFaceIndices.Add( GroupName, MoveTemp( AllFaceList ) );
                 }
 
                 if ( InvalidGroupNameIndices.Num() > 0 )
@@ -4540,64 +5417,215 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     }
                 }
 
-                // We also need to figure out / construct vertex list for everything that's not in a split group
-                TArray< int32 > GroupSplitFacesRemaining;
-                GroupSplitFacesRemaining.Init( -1, PartVertexList.Num() );
-                bool bMainSplitGroup = false;
-                GroupVertexListCount = 0;
-
+                // We also need to figure out the faces of everything that's not in a split group
                 TArray< int32 > GroupSplitFaceIndicesRemaining;
-                for ( int32 SplitVertexIdx = 0; SplitVertexIdx < AllSplitVertexList.Num(); SplitVertexIdx++ )
+                for ( int32 SplitFaceIdx = 0; SplitFaceIdx < AllSplitFaces.Num(); SplitFaceIdx++ )
+                {
+                    if ( !AllSplitFaces[ SplitFaceIdx ] )
+                    {
+                        // This is unused face, we need to add it to unused faces list.
+                        GroupSplitFaceIndicesRemaining.Add( SplitFaceIdx );
+                    }
+                }
+
+                // We store the remaining geo faces as a special name (main geo)
+                // and make sure its treated before the collider meshes
+                if ( GroupSplitFaceIndicesRemaining.Num() > 0 )
+                {
+                    SplitGroupNames.Insert( RemainingGroupName, nLODInsertPos );
+                    GroupSplitFaceCounts.Add( RemainingGroupName, GroupSplitFaceIndicesRemaining.Num() * 3 );
+                    GroupSplitFaceIndices.Add( RemainingGroupName, MoveTemp( GroupSplitFaceIndicesRemaining ) );
+                }
+            }
+            else
+            {
+                // No splitting required
+                SplitGroupNames.Add( RemainingGroupName );
+                GroupSplitFaceCounts.Add( RemainingGroupName, PartVertexList.Num() );
+
+                TArray<int32> AllFaces;
+                for ( int32 FaceIdx = 0; FaceIdx < PartInfo.faceCount; ++FaceIdx )
+                    AllFaces.Add( FaceIdx );
+
+                GroupSplitFaceIndices.Add( RemainingGroupName, AllFaces );
+            }
+
+            // Look for LOD Specific attributes, "lod_screensize" by default
+            TArray< float > LODScreenSizes;
+            HAPI_AttributeInfo AttribInfoLODScreenSize;
+            FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoLODScreenSize );
+            FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                "lod_screensize", AttribInfoLODScreenSize, LODScreenSizes );
+
+            // If the geometry and scaling factor have changed or if the user asked for a cook manually,
+            // the static meshes of this part will need to be rebuilt.
+            bool bRebuildPartGeometry = GeoInfo.hasGeoChanged || ForceRebuildStaticMesh || ForceRecookAll;
+
+            // Raw meshes of the split groups, indexed by split id.
+            TArray< FHoudiniSplitRawMesh > SplitRawMeshes;
+
+            // Content hashes of the split groups, and whether they match the previous cook, indexed by split id.
+            TArray< uint32 > SplitContentHashes;
+            TArray< bool > SplitContentUnchanged;
+            SplitContentHashes.SetNumZeroed( SplitGroupNames.Num() );
+            SplitContentUnchanged.SetNumZeroed( SplitGroupNames.Num() );
+
+            if ( bRebuildPartGeometry )
+            {
+                // Fetch everything the raw mesh builds need from HAPI first, so the builds themselves
+                // do not touch the session and can run in parallel.
+                if ( !FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                    AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                    HAPI_UNREAL_ATTRIB_POSITION, PartRawMeshData.AttribInfoPositions, PartRawMeshData.Positions ) )
+                {
+                    // Error retrieving positions.
+                    HOUDINI_LOG_MESSAGE(
+                        TEXT( "Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] unable to retrieve position data " )
+                        TEXT( "- skipping." ),
+                        ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName );
+
+                    continue;
+                }
+
+                if ( PartRawMeshData.bReadNormals )
                 {
-                    if ( AllSplitVertexList[ SplitVertexIdx ] == 0 )
+                    FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                        HAPI_UNREAL_ATTRIB_NORMAL, PartRawMeshData.AttribInfoNormals, PartRawMeshData.Normals );
+                }
+
+                FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                    AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                    HAPI_UNREAL_ATTRIB_COLOR, PartRawMeshData.AttribInfoColors, PartRawMeshData.Colors );
+
+                FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                    AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                    HAPI_UNREAL_ATTRIB_ALPHA, PartRawMeshData.AttribInfoAlpha, PartRawMeshData.Alphas );
+
+                FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+                    AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                    MarshallingAttributeNameFaceSmoothingMask.c_str(),
+                    PartRawMeshData.AttribInfoFaceSmoothingMasks, PartRawMeshData.FaceSmoothingMasks );
+
+                FHoudiniEngineUtils::GetAllUVAttributesInfoAndTexCoords(
+                    AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                    PartRawMeshData.AttribInfoUVs, PartRawMeshData.UVs );
+
+                // LODs share a single mesh and colliders feed the aggregate collision of other meshes,
+                // so only parts made of independent splits can skip unchanged ones.
+                bool bUseContentHash = !ForceRebuildStaticMesh && !ForceRecookAll;
+                for ( int32 SplitId = 0; bUseContentHash && SplitId < SplitGroupNames.Num(); ++SplitId )
+                {
+                    const FString & SplitGroupName = SplitGroupNames[ SplitId ];
+                    if ( SplitGroupName.StartsWith( LodGroupNamePrefix, ESearchCase::IgnoreCase )
+                        || SplitGroupName.StartsWith( SimpleCollisionGroupNamePrefix, ESearchCase::IgnoreCase )
+                        || SplitGroupName.StartsWith( SimpleRenderedCollisionGroupNamePrefix, ESearchCase::IgnoreCase )
+                        || SplitGroupName.StartsWith( UCXCollisionGroupNamePrefix, ESearchCase::IgnoreCase )
+                        || SplitGroupName.StartsWith( UCXRenderedCollisionGroupNamePrefix, ESearchCase::IgnoreCase ) )
+                    {
+                        bUseContentHash = false;
+                    }
+                }
+
+                if ( bUseContentHash )
+                {
+                    // Hash everything the meshes of this part are built from.
+                    uint32 PartContentHash = PartRawMeshData.GetContentHash();
+                    PartContentHash = HoudiniContentHashArray( PartVertexList, PartContentHash );
+                    PartContentHash = HoudiniContentHashArray( PartFaceMaterialIds, PartContentHash );
+                    PartContentHash = HoudiniContentHashArray( LODScreenSizes, PartContentHash );
+
+                    // Lightmap resolution is applied on top of the raw mesh.
+                    FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
+                        PartInfo.id, MarshallingAttributeNameLightmapResolution.c_str(),
+                        AttribLightmapResolution, PartLightMapResolutions );
+                    PartContentHash = HoudiniContentHashArray( PartLightMapResolutions, PartContentHash );
+
+                    // So are the material overrides.
+                    const std::string * MaterialAttributeNames[] = {
+                        &MarshallingAttributeNameMaterial, &MarshallingAttributeNameMaterialFallback,
+                        &MarshallingAttributeNameMaterialInstance };
+                    for ( int32 NameIdx = 0; NameIdx < ARRAY_COUNT( MaterialAttributeNames ); ++NameIdx )
+                    {
+                        TArray< FString > MaterialAttributeValues;
+                        HAPI_AttributeInfo AttribMaterial;
+                        FMemory::Memzero< HAPI_AttributeInfo >( AttribMaterial );
+                        FHoudiniEngineUtils::HapiGetAttributeDataAsString(
+                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                            MaterialAttributeNames[ NameIdx ]->c_str(), AttribMaterial, MaterialAttributeValues );
+
+                        PartContentHash = HoudiniContentHashAttributeInfo(
+                            AttribMaterial, HoudiniContentHashStrings( MaterialAttributeValues, PartContentHash ) );
+                    }
+
+                    // And the uproperty attributes.
+                    FHoudiniGeoPartObject UPropertyGeoPartObject( HoudiniGeoPartObject );
+                    UPropertyGeoPartObject.SplitName = TEXT( "" );
+                    TArray< UGenericAttribute > UProperties;
+                    FHoudiniEngineUtils::GetUPropertyAttributeList( UPropertyGeoPartObject, UProperties );
+                    for ( int32 UPropertyIdx = 0; UPropertyIdx < UProperties.Num(); ++UPropertyIdx )
+                    {
+                        const UGenericAttribute & UProperty = UProperties[ UPropertyIdx ];
+                        PartContentHash = HoudiniContentHashString( UProperty.AttributeName, PartContentHash );
+                        PartContentHash = HoudiniContentHashArray( UProperty.DoubleValues, PartContentHash );
+                        PartContentHash = HoudiniContentHashArray( UProperty.IntValues, PartContentHash );
+                        PartContentHash = HoudiniContentHashStrings( UProperty.StringValues, PartContentHash );
+                    }
+
+                    // Attributes appearing or disappearing may change the meshes in other ways.
+                    for ( int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx )
                     {
-                        // This is unused index, we need to add it to unused vertex list.
-                        GroupSplitFacesRemaining[ SplitVertexIdx ] = PartVertexList[ SplitVertexIdx ];
-                        bMainSplitGroup = true;
-                        GroupVertexListCount++;
+                        TArray< FString > AttributeNames;
+                        FHoudiniEngineAttributeDirectory::GetAttributeNames(
+                            GeoInfo.nodeId, PartInfo.id, (HAPI_AttributeOwner) OwnerIdx, AttributeNames );
+                        PartContentHash = HoudiniContentHashStrings( AttributeNames, PartContentHash );
                     }
-                }
 
-                for ( int32 SplitFaceIdx = 0; SplitFaceIdx < AllSplitFaceIndices.Num(); SplitFaceIdx++ )
-                {
-                    if ( AllSplitFaceIndices[ SplitFaceIdx ] == 0 )
+                    FHoudiniGeoPartObject SplitGeoPartObject( HoudiniGeoPartObject );
+                    for ( int32 SplitId = 0; SplitId < SplitGroupNames.Num(); ++SplitId )
                     {
-                        // This is unused face, we need to add it to unused faces list.
-                        GroupSplitFaceIndicesRemaining.Add( SplitFaceIdx );
+                        const FString & SplitGroupName = SplitGroupNames[ SplitId ];
+
+                        uint32 SplitContentHash = HoudiniContentHashString( SplitGroupName, PartContentHash );
+                        SplitContentHash = HoudiniContentHashArray( GroupSplitFaceIndices.FindChecked( SplitGroupName ), SplitContentHash );
+
+                        // Zero is reserved for meshes without a known hash.
+                        SplitContentHashes[ SplitId ] = SplitContentHash != 0 ? SplitContentHash : 1;
+
+                        SplitGeoPartObject.SplitId = SplitId;
+                        const uint32 * PreviousContentHash = PreviousContentHashes.Find( SplitGeoPartObject );
+                        SplitContentUnchanged[ SplitId ] = PreviousContentHash && *PreviousContentHash == SplitContentHashes[ SplitId ];
                     }
                 }
 
-                // We store the remaining geo vertex list as a special name (main geo)
-                // and make sure its treated before the collider meshes
-                if ( bMainSplitGroup )
+                // Assemble the raw meshes of all split groups in parallel.
+                SCOPE_CYCLE_COUNTER( STAT_BuildRawMeshes );
+
+                SplitRawMeshes.SetNum( SplitGroupNames.Num() );
+                ParallelFor( SplitGroupNames.Num(), [ & ]( int32 SplitId )
                 {
-                    SplitGroupNames.Insert( RemainingGroupName, nLODInsertPos );
-                    GroupSplitFaces.Add( RemainingGroupName, GroupSplitFacesRemaining );
-                    GroupSplitFaceCounts.Add( RemainingGroupName, GroupVertexListCount );
-                    GroupSplitFaceIndices.Add( RemainingGroupName, GroupSplitFaceIndicesRemaining );
-                }
-            }
-            else
-            {
-                // No splitting required
-                SplitGroupNames.Add( RemainingGroupName );
-                GroupSplitFaces.Add( RemainingGroupName, PartVertexList );
-                GroupSplitFaceCounts.Add( RemainingGroupName, PartVertexList.Num() );
+                    const FString & SplitGroupName = SplitGroupNames[ SplitId ];
 
-                TArray<int32> AllFaces;
-                for ( int32 FaceIdx = 0; FaceIdx < PartInfo.faceCount; ++FaceIdx )
-                    AllFaces.Add( FaceIdx );
+                    // Invisible UCX colliders are only used for convex hulls and do not need a mesh.
+                    if ( SplitGroupName.StartsWith( UCXCollisionGroupNamePrefix, ESearchCase::IgnoreCase ) )
+                        return;
 
-                GroupSplitFaceIndices.Add( RemainingGroupName, AllFaces );
-            }
+                    // Unchanged splits keep the mesh from the previous cook.
+                    if ( SplitContentUnchanged[ SplitId ] )
+                        return;
 
-            // Look for LOD Specific attributes, "lod_screensize" by default
-            TArray< float > LODScreenSizes;
-            HAPI_AttributeInfo AttribInfoLODScreenSize;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttribInfoLODScreenSize );
-            FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
-                "lod_screensize", AttribInfoLODScreenSize, LODScreenSizes );
+                    const TArray< int32 > & SplitGroupFaceIndices = GroupSplitFaceIndices.FindChecked( SplitGroupName );
+                    TArray< int32 > SplitGroupVertexList;
+                    FHoudiniEngineUtils::GetVertexListForFaces( PartVertexList, SplitGroupFaceIndices, SplitGroupVertexList );
+
+                    FHoudiniSplitRawMesh & SplitRawMesh = SplitRawMeshes[ SplitId ];
+                    SplitRawMesh.bIsValid = PartRawMeshData.BuildRawMesh(
+                        SplitGroupVertexList, GroupSplitFaceCounts.FindChecked( SplitGroupName ),
+                        SplitGroupFaceIndices.Num(), SplitRawMesh.RawMesh, SplitRawMesh.LightMapUVChannel );
+                } );
+            }
 
             // Keep track of the LOD Index
             int32 LodIndex = 0;
@@ -4608,6 +5636,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
             // Map of Houdini Material Attributes to Unreal Material Indices
             TMap< FString, int32 > MapHoudiniMatAttributesToUnrealIndex;
 
+            // Vertex list of the split being processed, expanded from its faces.
+            TArray< int32 > SplitGroupVertexList;
+
             // Iterate through all detected split groups we care about and split geometry.
             // The split are ordered in the following way:
             // Invisible Simple/Convex Colliders > LODs > MainGeo > Visible Colliders > Invisible Colliders
@@ -4616,15 +5647,15 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 // Get split group name
                 const FString & SplitGroupName = SplitGroupNames[ SplitId ];
 
-                // Get the vertex indices for this group
-                TArray< int32 > & SplitGroupVertexList = GroupSplitFaces[ SplitGroupName ];
-
                 // Get valid count of vertex indices for this split.
                 int32 SplitGroupVertexListCount = GroupSplitFaceCounts[ SplitGroupName ];
 
                 // Get face indices for this split.
                 TArray< int32 > & SplitGroupFaceIndices = GroupSplitFaceIndices[ SplitGroupName ];
 
+                // Get the vertex indices for this group, the buffer is reused by all splits.
+                FHoudiniEngineUtils::GetVertexListForFaces( PartVertexList, SplitGroupFaceIndices, SplitGroupVertexList );
+
                 // LOD meshes need to use the same SplitID (as they will be on the same static mesh)
                 bool IsLOD = SplitGroupName.StartsWith( LodGroupNamePrefix, ESearchCase::IgnoreCase );
                 if ( IsLOD && LodSplitId == -1 )
@@ -4641,6 +5672,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 // Record split id in geo part.
                 // LODs must use the same SplitID since they belong to the same static mesh
                 HoudiniGeoPartObject.SplitId = !IsLOD ? SplitId : LodSplitId;
+                HoudiniGeoPartObject.ContentHash = SplitContentHashes[ SplitId ];
 
                 // Reset collision flags for the current GeoPartObj
                 HoudiniGeoPartObject.bIsRenderCollidable = false;
@@ -4691,11 +5723,11 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 if ( HoudiniGeoPartObject.bIsUCXCollisionGeo )
                 {
                     // Retrieve the vertices positions if necessary
-                    if ( PartPositions.Num() <= 0 )
+                    if ( PartRawMeshData.Positions.Num() <= 0 )
                     {
 						if ( !FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
                             AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, PartPositions ) )
+                            PartInfo.id, HAPI_UNREAL_ATTRIB_POSITION, PartRawMeshData.AttribInfoPositions, PartRawMeshData.Positions ) )
                         {
                             // Error retrieving positions.
                             HOUDINI_LOG_MESSAGE(
@@ -4713,7 +5745,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         MultiHullDecomp = true;
 
                     // Create the convex hull colliders and add them to the Aggregate
-                    if ( AddConvexCollisionToAggregate( PartPositions, SplitGroupVertexList, MultiHullDecomp, AggregateCollisionGeo ) )
+                    if ( AddConvexCollisionToAggregate( PartRawMeshData.Positions, SplitGroupVertexList, MultiHullDecomp, AggregateCollisionGeo ) )
                     {
                         // We'll add the collision after all the meshes are generated unless this a rendered_collision_geo_ucx
                         bHasAggregateGeometryCollision = true;
@@ -4739,9 +5771,17 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                 // If the geometry and scaling factor have changed or if the user asked for a cook manually,
                 // we will need to rebuild the static mesh. If not, then we can reuse the corresponding static mesh.
-                if ( GeoInfo.hasGeoChanged || ForceRebuildStaticMesh || ForceRecookAll )
+                // The same goes for splits whose content is identical to the previous cook.
+                if ( bRebuildPartGeometry && !SplitContentUnchanged[ SplitId ] )
                     bRebuildStaticMesh = true;
 
+                // Meshes that were not rehashed keep the hash of their content.
+                if ( !bRebuildPartGeometry )
+                {
+                    const uint32 * PreviousContentHash = PreviousContentHashes.Find( HoudiniGeoPartObject );
+                    HoudiniGeoPartObject.ContentHash = PreviousContentHash ? *PreviousContentHash : 0;
+                }
+
                 // The geometry has not changed,
                 if ( !bRebuildStaticMesh )
                 {
@@ -4830,231 +5870,21 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                 if ( bRebuildStaticMesh )
                 {
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    // NORMALS
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    TArray< float > SplitGroupNormals;
-
-                    // No need to read the normals if we'll recompute them after
-                    bool bReadNormals = HoudiniRuntimeSettings->RecomputeNormalsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;		   
-                    if ( bReadNormals )
-                    {
-                        if ( PartNormals.Num() <= 0 )
-                        {
-                            // Retrieve normal data for this part
-                            FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                                AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                                PartInfo.id, HAPI_UNREAL_ATTRIB_NORMAL, AttribInfoNormals, PartNormals );
-                        }
-
-                        // See if we need to transfer normal point attributes to vertex attributes.
-                        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                            SplitGroupVertexList, AttribInfoNormals, PartNormals, SplitGroupNormals );
-                    }
-
-                    // See if we need to generate tangents, we do this only if normals are present, and if we do not recompute them after
-                    bool bGenerateTangents = ( SplitGroupNormals.Num() > 0 );
-                    if ( bGenerateTangents && ( HoudiniRuntimeSettings->RecomputeTangentsFlag == EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always ) )
-                    {
-                        // No need to generate tangents if we'll recompute them after
-                        bGenerateTangents = false;
-                    }
-
-                    // Transfer normals.
-                    int32 WedgeNormalCount = SplitGroupNormals.Num() / 3;
-                    RawMesh.WedgeTangentZ.SetNumZeroed( WedgeNormalCount );
-                    for ( int32 WedgeTangentZIdx = 0; WedgeTangentZIdx < WedgeNormalCount; ++WedgeTangentZIdx )
-                    {
-                        FVector WedgeTangentZ;
-                        WedgeTangentZ.X = SplitGroupNormals[ WedgeTangentZIdx * 3 + 0 ];
-                        if ( ImportAxis == HRSAI_Unreal )
-                        {
-                            // We need to flip Z and Y coordinate
-                            WedgeTangentZ.Y = SplitGroupNormals[ WedgeTangentZIdx * 3 + 2 ];
-                            WedgeTangentZ.Z = SplitGroupNormals[ WedgeTangentZIdx * 3 + 1 ];
-                        }
-                        else
-                        {
-                            WedgeTangentZ.Y = SplitGroupNormals[ WedgeTangentZIdx * 3 + 1 ];
-                            WedgeTangentZ.Z = SplitGroupNormals[ WedgeTangentZIdx * 3 + 2 ];
-                        }
-
-                        RawMesh.WedgeTangentZ[ WedgeTangentZIdx ] = WedgeTangentZ;
-
-                        // If we need to generate tangents.
-                        if ( bGenerateTangents )
-                        {
-                            FVector TangentX, TangentY;
-                            WedgeTangentZ.FindBestAxisVectors( TangentX, TangentY );
-
-                            RawMesh.WedgeTangentX.Add( TangentX );
-                            RawMesh.WedgeTangentY.Add( TangentY );
-                        }
-                    }
-
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    //	VERTEX COLORS AND ALPHAS
-                    //--------------------------------------------------------------------------------------------------------------------- 		                        
-                    TArray< float > SplitGroupColors;
-                    if ( PartColors.Num() <= 0 )
+                    // The geometry of this split has been assembled by the parallel raw mesh build.
+                    FHoudiniSplitRawMesh & SplitRawMesh = SplitRawMeshes[ SplitId ];
+                    if ( !SplitRawMesh.bIsValid )
                     {
-                        // Retrieve color data
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, PartColors );
-                    }
-
-                    // See if we need to transfer color point attributes to vertex attributes.
-                    FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                        SplitGroupVertexList, AttribInfoColors, PartColors, SplitGroupColors );
-
-                    TArray< float > SplitGroupAlphas;
-                    if ( PartAlphas.Num() <= 0 )
-                    {
-                        // Retrieve alpha data
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, HAPI_UNREAL_ATTRIB_ALPHA, AttribInfoAlpha, PartAlphas );
-                    }
-
-                    // See if we need to transfer alpha point attributes to vertex attributes.
-                    FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                        SplitGroupVertexList, AttribInfoAlpha, PartAlphas, SplitGroupAlphas );
-
-                    // Transfer colors and alphas to the raw mesh
-                    if ( AttribInfoColors.exists && ( AttribInfoColors.tupleSize > 0 ) )
-                    {
-                        int32 WedgeColorsCount = SplitGroupColors.Num() / AttribInfoColors.tupleSize;
-                        RawMesh.WedgeColors.SetNumZeroed( WedgeColorsCount );
-                        for ( int32 WedgeColorIdx = 0; WedgeColorIdx < WedgeColorsCount; ++WedgeColorIdx )
-                        {
-                            FLinearColor WedgeColor;
-                            WedgeColor.R = FMath::Clamp(
-                                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 0 ], 0.0f, 1.0f );
-                            WedgeColor.G = FMath::Clamp(
-                                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 1 ], 0.0f, 1.0f );
-                            WedgeColor.B = FMath::Clamp(
-                                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 2 ], 0.0f, 1.0f );
-
-                            if( AttribInfoAlpha.exists )
-                            {
-                                WedgeColor.A = FMath::Clamp( SplitGroupAlphas[ WedgeColorIdx ], 0.0f, 1.0f );
-                            }
-                            else if ( AttribInfoColors.tupleSize == 4 )
-                            {
-                                // We have alpha.
-                                WedgeColor.A = FMath::Clamp(
-                                    SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 3 ], 0.0f, 1.0f );
-                            }
-                            else
-                            {
-                                WedgeColor.A = 1.0f;
-                            }
-
-                            // Convert linear color to fixed color.
-                            RawMesh.WedgeColors[ WedgeColorIdx ] = WedgeColor.ToFColor( false );
-                        }
-                    }
-                    else
-                    {
-                        // No Colors or Alphas, init colors to White
-                        FColor DefaultWedgeColor = FLinearColor::White.ToFColor( false );
-                        int32 WedgeColorsCount = RawMesh.WedgeIndices.Num();
-                        if ( WedgeColorsCount > 0 )
-                            RawMesh.WedgeColors.Init( DefaultWedgeColor, WedgeColorsCount );
-                    }
-
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    //	FACE SMOOTHING
-                    //--------------------------------------------------------------------------------------------------------------------- 
-
-                    // Retrieve face smoothing data.
-                    if ( PartFaceSmoothingMasks.Num() <= 0 )
-                    {
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, MarshallingAttributeNameFaceSmoothingMask.c_str(),
-                            AttribInfoFaceSmoothingMasks, PartFaceSmoothingMasks );
-                    }
-
-                    // Set face smoothing masks.
-                    RawMesh.FaceSmoothingMasks.SetNumZeroed( SplitGroupFaceCount );
-                    if ( PartFaceSmoothingMasks.Num() )
-                    {
-                        int32 ValidFaceIdx = 0;
-                        for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx += 3 )
-                        {
-                            int32 WedgeCheck = SplitGroupVertexList[ VertexIdx + 0 ];
-                            if ( WedgeCheck == -1 )
-                                continue;
-
-                            RawMesh.FaceSmoothingMasks[ ValidFaceIdx ] = PartFaceSmoothingMasks[ VertexIdx / 3 ];
-                            ValidFaceIdx++;
-                        }
-                    }
-
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    //	UVS
-                    //--------------------------------------------------------------------------------------------------------------------- 
-
-                    // Extract all UV sets
-                    TArray< TArray< float > > SplitGroupUVs;
-                    SplitGroupUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
-
-                    if ( PartUVs.Num() && PartUVs[0].Num() <= 0 )
-                    {
-                        // Retrieve all the UVs sets for this part
-                        FHoudiniEngineUtils::GetAllUVAttributesInfoAndTexCoords(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
-                            AttribInfoUVs, PartUVs );
-                    }
-
-                    // See if we need to transfer uv point attributes to vertex attributes.
-                    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
-                    {
-                        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                            SplitGroupVertexList, AttribInfoUVs[ TexCoordIdx ], PartUVs[ TexCoordIdx ], SplitGroupUVs[ TexCoordIdx ] );
-                    }
-
-                    // Transfer UVs to the Raw Mesh
-                    int32 UVChannelCount = 0;
-                    int32 LightMapUVChannel = 0;
-                    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
-                    {
-                        TArray< float > & TextureCoordinate = SplitGroupUVs[ TexCoordIdx ];
-                        if ( TextureCoordinate.Num() > 0 )
-                        {
-                            int32 WedgeUVCount = TextureCoordinate.Num() / 2;
-                            RawMesh.WedgeTexCoords[ TexCoordIdx ].SetNumZeroed( WedgeUVCount );
-                            for ( int32 WedgeUVIdx = 0; WedgeUVIdx < WedgeUVCount; ++WedgeUVIdx )
-                            {
-                                // We need to flip V coordinate when it's coming from HAPI.
-                                FVector2D WedgeUV;
-                                WedgeUV.X = TextureCoordinate[ WedgeUVIdx * 2 + 0 ];
-                                WedgeUV.Y = 1.0f - TextureCoordinate[ WedgeUVIdx * 2 + 1 ];
-
-                                RawMesh.WedgeTexCoords[ TexCoordIdx ][ WedgeUVIdx ] = WedgeUV;
-                            }
-
-                            UVChannelCount++;
+                        // This mesh contains only degenerate triangles, there's nothing we can do.
+                        if ( bStaticMeshCreated )
+                            StaticMesh->MarkPendingKill();
 
-                            if ( UVChannelCount <= 2 )
-                                LightMapUVChannel = TexCoordIdx;
-                        }
-                        else
-                        {
-                            RawMesh.WedgeTexCoords[ TexCoordIdx ].Empty();
-                        }
+                        continue;
                     }
 
-                    // We have to have at least one UV channel. If there's none, create one with zero data.
-                    if ( UVChannelCount == 0 )
-                        RawMesh.WedgeTexCoords[ 0 ].SetNumZeroed( SplitGroupVertexListCount );
+                    RawMesh = MoveTemp( SplitRawMesh.RawMesh );
 
                     // Set the lightmap Coordinate Index
-                    // If we have more than one UV set, the 2nd set will be used for lightmaps by convention
-                    // If not, the first UV set will be used
-                    StaticMesh->LightMapCoordinateIndex = LightMapUVChannel;
+                    StaticMesh->LightMapCoordinateIndex = SplitRawMesh.LightMapUVChannel;
 
                     //--------------------------------------------------------------------------------------------------------------------- 
                     // LIGHTMAP RESOLUTION
@@ -5068,174 +5898,6 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                             PartInfo.id, MarshallingAttributeNameLightmapResolution.c_str(),
                             AttribLightmapResolution, PartLightMapResolutions );
                     }
-
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    //	INDICES
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    
-                    //
-                    // Because of the splits, we don't need to declare all the vertices in the Part, 
-                    // but only the one that are currently used by the split's faces.
-                    // The indicesMapper array is used to map those indices from Part Vertices to Split Vertices.
-                    // We also keep track of the needed vertices index to declare them easily afterwards.
-                    //
-
-                    // IndicesMapper:
-                    // Maps index values for all vertices in the Part:
-                    // - Vertices unused by the split will be set to -1
-                    // - Used vertices will have their value set to the "NewIndex"
-                    // So that IndicesMapper[ oldIndex ] => newIndex
-                    TArray< int32 > IndicesMapper;
-                    IndicesMapper.Init( -1, SplitGroupVertexList.Num() );
-                    int32 CurrentMapperIndex = 0;
-
-                    // Neededvertices:
-                    // Contains the old index of the needed vertices for the current split
-                    // NeededVertices[ newIndex ] => oldIndex
-                    TArray< int32 > NeededVertices;
-
-                    RawMesh.WedgeIndices.SetNumZeroed( SplitGroupVertexListCount );
-                    int32 ValidVertexId = 0;
-                    for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx += 3 )
-                    {
-                        int32 WedgeCheck = SplitGroupVertexList[ VertexIdx + 0 ];
-                        if ( WedgeCheck == -1 )
-                            continue;
-
-                        int32 WedgeIndices[ 3 ] = 
-                        {
-                            SplitGroupVertexList[ VertexIdx + 0 ],
-                            SplitGroupVertexList[ VertexIdx + 1 ],
-                            SplitGroupVertexList[ VertexIdx + 2 ]
-                        };
-
-                        // Converting Old (Part) Indices to New (Split) Indices:
-                        for ( int32 i = 0; i < 3; i++ )
-                        {
-                            if ( IndicesMapper[ WedgeIndices[ i ] ] < 0 )
-                            {
-                                // This old index was not yet "converted" to a new index
-                                NeededVertices.Add( WedgeIndices[ i ] );
-
-                                IndicesMapper[ WedgeIndices[ i ] ] = CurrentMapperIndex;
-                                CurrentMapperIndex++;
-                            }
-                               
-                            // Replace the old index with the new one
-                            WedgeIndices[ i ] = IndicesMapper[ WedgeIndices[ i ] ];
-                        }
-
-                        if ( ValidVertexId >= SplitGroupVertexListCount )
-                            continue;
-
-                        if ( ImportAxis == HRSAI_Unreal )
-                        {
-                            // Flip wedge indices to fix the winding order.
-                            RawMesh.WedgeIndices[ ValidVertexId + 0 ] = WedgeIndices[ 0 ];
-                            RawMesh.WedgeIndices[ ValidVertexId + 1 ] = WedgeIndices[ 2 ];
-                            RawMesh.WedgeIndices[ ValidVertexId + 2 ] = WedgeIndices[ 1 ];
-
-                            // Check if we need to patch UVs.
-                            for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
-                            {
-                                if ( RawMesh.WedgeTexCoords[ TexCoordIdx ].Num() > 0
-                                    && ( (ValidVertexId + 2) < RawMesh.WedgeTexCoords[ TexCoordIdx ].Num() ) )
-                                {
-                                    Swap( RawMesh.WedgeTexCoords[ TexCoordIdx ][ ValidVertexId + 1 ],
-                                        RawMesh.WedgeTexCoords[ TexCoordIdx ][ ValidVertexId + 2 ] );
-                                }
-                            }
-
-                            // Check if we need to patch colors.
-                            if ( RawMesh.WedgeColors.Num() > 0 )
-                                Swap( RawMesh.WedgeColors[ ValidVertexId + 1 ], RawMesh.WedgeColors[ ValidVertexId + 2 ] );
-
-                            // Check if we need to patch Normals and tangents.
-                            if ( RawMesh.WedgeTangentZ.Num() > 0 )
-                                Swap( RawMesh.WedgeTangentZ[ ValidVertexId + 1 ], RawMesh.WedgeTangentZ[ ValidVertexId + 2 ] );
-
-                            if ( RawMesh.WedgeTangentX.Num() > 0 )
-                                Swap( RawMesh.WedgeTangentX[ ValidVertexId + 1 ], RawMesh.WedgeTangentX[ ValidVertexId + 2 ] );
-
-                            if ( RawMesh.WedgeTangentY.Num() > 0 )
-                                Swap ( RawMesh.WedgeTangentY[ ValidVertexId + 1 ], RawMesh.WedgeTangentY[ ValidVertexId + 2 ] );
-                        }
-                        else if ( ImportAxis == HRSAI_Houdini )
-                        {
-                            // Dont flip the wedge indices
-                            RawMesh.WedgeIndices[ ValidVertexId + 0 ] = WedgeIndices[ 0 ];
-                            RawMesh.WedgeIndices[ ValidVertexId + 1 ] = WedgeIndices[ 1 ];
-                            RawMesh.WedgeIndices[ ValidVertexId + 2 ] = WedgeIndices[ 2 ];
-                        }
-
-                        ValidVertexId += 3;
-                    }
-
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    // POSITIONS
-                    //--------------------------------------------------------------------------------------------------------------------- 
-
-                    // We may already have gotten the positions when creating the ucx collisions
-                    if ( PartPositions.Num() <= 0 )
-                    {
-                        // Retrieve position data.
-                        if ( !FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, PartPositions ) )
-                        {
-                            // Error retrieving positions.
-                            HOUDINI_LOG_MESSAGE(
-                                TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] unable to retrieve position data ")
-                                TEXT("- skipping."),
-                                ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName);
-
-                            if ( bStaticMeshCreated )
-                                StaticMesh->MarkPendingKill();
-
-                            break;
-                        }
-                    }
-
-                    //
-                    // Transfer vertex positions:
-                    //
-                    // Because of the split, we're only interested in the needed vertices.
-                    // Instead of declaring all the Positions, we'll only declare the vertices
-                    // needed by the current split.
-                    //
-                    int32 VertexPositionsCount = NeededVertices.Num();
-                    RawMesh.VertexPositions.SetNumZeroed( VertexPositionsCount );
-                    for ( int32 VertexPositionIdx = 0; VertexPositionIdx < VertexPositionsCount; ++VertexPositionIdx )
-                    {
-                        int32 NeededVertexIndex = NeededVertices[ VertexPositionIdx ];
-
-                        FVector VertexPosition;
-                        VertexPosition.X = PartPositions[ NeededVertexIndex * 3 + 0 ] * GeneratedGeometryScaleFactor;
-                        if ( ImportAxis == HRSAI_Unreal )
-                        {
-                            // We need to swap Z and Y coordinate here.                            
-                            VertexPosition.Y = PartPositions[ NeededVertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
-                            VertexPosition.Z = PartPositions[ NeededVertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
-                        }
-                        else if ( ImportAxis == HRSAI_Houdini )
-                        {
-                            // No swap required.
-                            VertexPosition.Y = PartPositions[ NeededVertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
-                            VertexPosition.Z = PartPositions[ NeededVertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
-                        }
-
-                        RawMesh.VertexPositions[ VertexPositionIdx ] = VertexPosition;
-                    }
-
-                    // We need to check if this mesh contains only degenerate triangles.
-                    if ( FHoudiniEngineUtils::CountDegenerateTriangles( RawMesh ) == SplitGroupFaceCount )
-                    {
-                        // This mesh contains only degenerate triangles, there's nothing we can do.
-                        if ( bStaticMeshCreated )
-                            StaticMesh->MarkPendingKill();
-
-                        continue;
-                    }
                 }
                 else
                 {
@@ -5714,14 +6376,23 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 // Try to update the uproperties of the StaticMesh
                 UpdateUPropertyAttributesOnObject( StaticMesh, HoudiniGeoPartObject);
 
-                // Free any RHI resources.
-                StaticMesh->PreEditChange( nullptr );
-
                 FHoudiniScopedGlobalSilence ScopedGlobalSilence;
+
+                // Meshes which do not need their render data for collision generation can be built later,
+                // they keep their previous render data until then.
+                if ( HoudiniCookParams.DeferredStaticMeshBuilds
+                    && !HoudiniGeoPartObject.bIsSimpleCollisionGeo && !bHasAggregateGeometryCollision )
+                {
+                    HoudiniCookParams.DeferredStaticMeshBuilds->AddUnique( StaticMesh );
+                }
+                else
                 {
+                    // Free any RHI resources.
+                    StaticMesh->PreEditChange( nullptr );
+
                     SCOPE_CYCLE_COUNTER( STAT_BuildStaticMesh );
                     StaticMesh->Build( false );
-				}
+                }
 
                 // Do we need to add simple collisions ?
                 bool bSimpleCollisionAddedToAggregate = false;
@@ -6068,14 +6739,6 @@ FHoudiniEngineUtils::DeleteFaceMaterialArray( TArray< char * > & OutStaticMeshFa
 void
 FHoudiniEngineUtils::ExtractStringPositions( const FString & Positions, TArray< FVector > & OutPositions )
 {
-    TArray< FString > PointStrings;
-
-    static const TCHAR * PositionSeparators[] =
-    {
-        TEXT( " " ),
-        TEXT( "," ),
-    };
-
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
     float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
@@ -6087,15 +6750,32 @@ FHoudiniEngineUtils::ExtractStringPositions( const FString & Positions, TArray<
         ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
 
-    int32 NumCoords = Positions.ParseIntoArray( &PointStrings, PositionSeparators, 2 );
-    for ( int32 CoordIdx = 0; CoordIdx < NumCoords; CoordIdx += 3 )
+    // Tokens are read in place, separated by spaces or commas, without splitting the string into an array.
+    const TCHAR * Cursor = *Positions;
+    auto ReadNextCoord = [ &Cursor ]( float & OutValue )
     {
-        FVector Position;
+        while ( *Cursor == TEXT( ' ' ) || *Cursor == TEXT( ',' ) )
+            ++Cursor;
+
+        if ( !*Cursor )
+            return false;
 
-        Position.X = FCString::Atof( *PointStrings[ CoordIdx + 0 ] );
-        Position.Y = FCString::Atof( *PointStrings[ CoordIdx + 1 ] );
-        Position.Z = FCString::Atof( *PointStrings[ CoordIdx + 2 ] );
+        TCHAR Token[ 64 ];
+        int32 TokenLength = 0;
+        for ( ; *Cursor && *Cursor != TEXT( ' ' ) && *Cursor != TEXT( ',' ); ++Cursor )
+        {
+            if ( TokenLength < ARRAY_COUNT( Token ) - 1 )
+                Token[ TokenLength++ ] = *Cursor;
+        }
+
+        Token[ TokenLength ] = TEXT( '\0' );
+        OutValue = FCString::Atof( Token );
+        return true;
+    };
 
+    FVector Position;
+    while ( ReadNextCoord( Position.X ) && ReadNextCoord( Position.Y ) && ReadNextCoord( Position.Z ) )
+    {
         Position *= GeneratedGeometryScaleFactor;
 
         if ( ImportAxis == HRSAI_Unreal )
@@ -6132,6 +6812,10 @@ FHoudiniEngineUtils::CreatePositionsString( const TArray< FVector > & Positions,
         ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
 
+    // Each point is formatted into a stack buffer and appended to a preallocated string.
+    PositionString.Reserve( Positions.Num() * 36 );
+    TCHAR PointBuffer[ 256 ];
+
     for ( int32 Idx = 0; Idx < Positions.Num(); ++Idx )
     {
         FVector Position = Positions[ Idx ];
@@ -6153,7 +6837,8 @@ FHoudiniEngineUtils::CreatePositionsString( const TArray< FVector > & Positions,
         if ( GeneratedGeometryScaleFactor != 0.0f )
             Position /= GeneratedGeometryScaleFactor;
 
-        PositionString += FString::Printf( TEXT( "%f, %f, %f " ), Position.X, Position.Y, Position.Z );
+        FCString::Sprintf( PointBuffer, TEXT( "%f, %f, %f " ), Position.X, Position.Y, Position.Z );
+        PositionString += PointBuffer;
     }
 }
 
@@ -6456,48 +7141,46 @@ FHoudiniEngineUtils::LoadLibHAPI( FString & StoredLibHAPILocation )
 }
 
 int32
-FHoudiniEngineUtils::HapiGetVertexListForGroup(
+FHoudiniEngineUtils::HapiGetFaceListForGroup(
     HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
-    HAPI_PartId PartId, const FString & GroupName,
-    const TArray< int32 > & FullVertexList, TArray< int32 > & NewVertexList,
-    TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
-    TArray< int32 > & AllCollisionFaceIndices, const bool& isPackedPrim )
+    HAPI_PartId PartId, const FString & GroupName, TArray< int32 > & FaceList,
+    TBitArray<> & OwnedFaces )
 {
-    NewVertexList.Init( -1, FullVertexList.Num() );
-    int32 ProcessedWedges = 0;
-
-    AllFaceList.Empty();
+    FaceList.Empty();
 
     TArray< int32 > PartGroupMembership;
     FHoudiniEngineUtils::HapiGetGroupMembership(
         AssetId, ObjectId, GeoId, PartId, HAPI_GROUPTYPE_PRIM, GroupName, PartGroupMembership );
 
     // Go through all primitives.
-    for ( int32 FaceIdx = 0; FaceIdx < PartGroupMembership.Num(); ++FaceIdx )
+    const int32 FaceCount = FMath::Min( PartGroupMembership.Num(), OwnedFaces.Num() );
+    for ( int32 FaceIdx = 0; FaceIdx < FaceCount; ++FaceIdx )
     {
         if ( PartGroupMembership[ FaceIdx ] > 0 )
         {
-            // Add face.
-            AllFaceList.Add( FaceIdx );
-
             // This face is a member of specified group.
-            NewVertexList[ FaceIdx * 3 + 0 ] = FullVertexList[ FaceIdx * 3 + 0 ];
-            NewVertexList[ FaceIdx * 3 + 1 ] = FullVertexList[ FaceIdx * 3 + 1 ];
-            NewVertexList[ FaceIdx * 3 + 2 ] = FullVertexList[ FaceIdx * 3 + 2 ];
-
-            // Mark these vertex indices as used.
-            AllVertexList[ FaceIdx * 3 + 0 ] = 1;
-            AllVertexList[ FaceIdx * 3 + 1 ] = 1;
-            AllVertexList[ FaceIdx * 3 + 2 ] = 1;
+            FaceList.Add( FaceIdx );
 
             // Mark this face as used.
-            AllCollisionFaceIndices[ FaceIdx ] = 1;
-
-            ProcessedWedges += 3;
+            OwnedFaces[ FaceIdx ] = true;
         }
     }
 
-    return ProcessedWedges;
+    return FaceList.Num() * 3;
+}
+
+void
+FHoudiniEngineUtils::GetVertexListForFaces(
+    const TArray< int32 > & FullVertexList, const TArray< int32 > & FaceList, TArray< int32 > & NewVertexList )
+{
+    NewVertexList.Init( -1, FullVertexList.Num() );
+
+    for ( int32 FaceIdx : FaceList )
+    {
+        NewVertexList[ FaceIdx * 3 + 0 ] = FullVertexList[ FaceIdx * 3 + 0 ];
+        NewVertexList[ FaceIdx * 3 + 1 ] = FullVertexList[ FaceIdx * 3 + 1 ];
+        NewVertexList[ FaceIdx * 3 + 2 ] = FullVertexList[ FaceIdx * 3 + 2 ];
+    }
 }
 
 
@@ -6736,7 +7419,44 @@ FHoudiniEngineUtils::GetAssetNames(
         if ( FPaths::IsRelative( AssetFileName ) && ( FHoudiniEngine::Get().GetSession()->type != HAPI_SESSION_INPROCESS ) )
             AssetFileName = FPaths::ConvertRelativePathToFull( AssetFileName );
 
-        if ( !AssetFileName.IsEmpty() && FPaths::FileExists( AssetFileName ) )
+        // Libraries are only loaded once per session, unless the file changed on disk or, for libraries
+        // loaded from memory, the asset bytes changed.
+        const bool bLibraryFileExists = !AssetFileName.IsEmpty() && FPaths::FileExists( AssetFileName );
+        FDateTime LibraryTimeStamp = FDateTime::MinValue();
+        uint32 LibraryContentHash = 0u;
+        if ( bLibraryFileExists )
+            LibraryTimeStamp = IFileManager::Get().GetTimeStamp( *AssetFileName );
+        else if ( HoudiniAsset->GetAssetBytes() && HoudiniAsset->GetAssetBytesCount() > 0 )
+            LibraryContentHash = FCrc::MemCrc32( HoudiniAsset->GetAssetBytes(), HoudiniAsset->GetAssetBytesCount() );
+
+        // Libraries loaded from memory have no usable path, they are keyed on their content instead.
+        const FString LibraryPath = bLibraryFileExists ?
+            AssetFileName : FString::Printf( TEXT( "mem:%08x" ), LibraryContentHash );
+
+        AssetLibraryId = FHoudiniEngineAssetLibraryCache::FindLibrary(
+            LibraryPath, LibraryTimeStamp, LibraryContentHash, AssetCount );
+
+        if ( AssetLibraryId >= 0 )
+        {
+            // Asset name handles are fetched again, they might not outlive the cook they were retrieved for.
+            AssetNames.SetNumUninitialized( AssetCount );
+            if ( AssetCount > 0 && FHoudiniApi::GetAvailableAssets(
+                FHoudiniEngine::Get().GetSession(), AssetLibraryId, &AssetNames[ 0 ], AssetCount ) == HAPI_RESULT_SUCCESS )
+            {
+                OutAssetLibraryId = AssetLibraryId;
+                OutAssetNames = AssetNames;
+
+                return true;
+            }
+
+            // The library is no longer valid in this session, load it again.
+            FHoudiniEngineAssetLibraryCache::RemoveLibrary( LibraryPath );
+            AssetLibraryId = -1;
+            AssetCount = 0;
+            AssetNames.Empty();
+        }
+
+        if ( bLibraryFileExists )
         {
             // We'll need to modify the file name for expanded .hda
             FString FileExtension = FPaths::GetExtension( AssetFileName );
@@ -6811,6 +7531,9 @@ FHoudiniEngineUtils::GetAssetNames(
             return false;
         }
 
+        FHoudiniEngineAssetLibraryCache::AddLibrary(
+            LibraryPath, LibraryTimeStamp, LibraryContentHash, AssetLibraryId, AssetCount );
+
         OutAssetLibraryId = AssetLibraryId;
         OutAssetNames = AssetNames;
     
@@ -7408,24 +8131,13 @@ FHoudiniEngineUtils::GetGenericAttributeList(
     int32 PrimitiveIndex )
 {
     HAPI_NodeId NodeId = GeoPartObject.HapiGeoGetNodeId();
-    HAPI_PartInfo PartInfo;
-    if ( !GeoPartObject.HapiPartGetInfo( PartInfo ) )
-        return 0;
-
     HAPI_PartId PartId = GeoPartObject.GetPartId();
 
     int32 nUPropCount = 0;
 
     // Get All attribute names for that part
-    int32 nAttribCount = PartInfo.attributeCounts[ AttributeOwner ];
-
-    TArray<HAPI_StringHandle> AttribNameSHArray;
-    AttribNameSHArray.SetNum( nAttribCount );
-
-    if ( HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeNames(
-        FHoudiniEngine::Get().GetSession(),
-        NodeId, PartInfo.id, AttributeOwner,
-        AttribNameSHArray.GetData(), nAttribCount ) )
+    TArray< FString > AttribNames;
+    if ( !FHoudiniEngineAttributeDirectory::GetAttributeNames( NodeId, PartId, AttributeOwner, AttribNames ) )
         return 0;
 
     // Since generic attributes can be on primitives, we may have to identify if a split occured during the mesh creation.
@@ -7465,11 +8177,9 @@ FHoudiniEngineUtils::GetGenericAttributeList(
             PrimIndexForSplit = 0;
     }
 
-    for ( int32 Idx = 0; Idx < AttribNameSHArray.Num(); ++Idx )
+    for ( int32 Idx = 0; Idx < AttribNames.Num(); ++Idx )
     {
-        FString HapiString = TEXT("");
-        FHoudiniEngineString HoudiniEngineString( AttribNameSHArray[ Idx ] );
-        HoudiniEngineString.ToFString( HapiString );
+        const FString & HapiString = AttribNames[ Idx ];
 
         if ( HapiString.StartsWith( GenericAttributePrefix,  ESearchCase::IgnoreCase ) )
         {
@@ -7575,16 +8285,7 @@ FHoudiniEngineUtils::GetGenericAttributeList(
                     HapiSHArray.GetData(), 0, AttribInfo.count ), false );
 
                 // Convert them to FString
-                CurrentUProperty.StringValues.SetNumZeroed( AttribInfo.count * AttribInfo.tupleSize );
-
-                for( int32 IdxSH = 0; IdxSH < HapiSHArray.Num(); IdxSH++ )
-                {
-                    FString CurrentString;
-                    FHoudiniEngineString HEngineString( HapiSHArray[ IdxSH ] );
-                    HEngineString.ToFString( CurrentString );
-
-                    CurrentUProperty.StringValues[ IdxSH ] = CurrentString;
-                }
+                FHoudiniEngineStringCache::ResolveHandles( HapiSHArray, CurrentUProperty.StringValues );
             }
             else
             {
@@ -8546,30 +9247,16 @@ FHoudiniEngineUtils::HapiGetAttributeOfType(
 {
     int32 NumberOfAttributeFound = 0;
 
-    // Get the part infos
-    HAPI_PartInfo PartInfo;
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetPartInfo(
-        FHoudiniEngine::Get().GetSession(), 
-        GeoId, PartId, &PartInfo ), NumberOfAttributeFound );
-
     // Get All attribute names for that part
-    int32 nAttribCount = PartInfo.attributeCounts[AttributeOwner];
-
-    TArray<HAPI_StringHandle> AttribNameSHArray;
-    AttribNameSHArray.SetNum( nAttribCount );
-
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeNames(
-        FHoudiniEngine::Get().GetSession(),
-        GeoId, PartInfo.id, AttributeOwner,
-        AttribNameSHArray.GetData(), nAttribCount ), NumberOfAttributeFound );
+    TArray< FString > AttribNames;
+    if ( !FHoudiniEngineAttributeDirectory::GetAttributeNames( GeoId, PartId, AttributeOwner, AttribNames ) )
+        return NumberOfAttributeFound;
 
     // Iterate on all the attributes, and get their part infos to get their type    
-    for ( int32 Idx = 0; Idx < AttribNameSHArray.Num(); ++Idx )
+    for ( int32 Idx = 0; Idx < AttribNames.Num(); ++Idx )
     {
         // Get the name ...
-        FString HapiString = TEXT("");
-        FHoudiniEngineString HoudiniEngineString( AttribNameSHArray[ Idx ] );
-        HoudiniEngineString.ToFString( HapiString );
+        const FString & HapiString = AttribNames[ Idx ];
 
         // ... then the attribute info
         HAPI_AttributeInfo AttrInfo;
@@ -8577,7 +9264,7 @@ FHoudiniEngineUtils::HapiGetAttributeOfType(
 
         if ( HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo( 
             FHoudiniEngine::Get().GetSession(),
-            GeoId, PartInfo.id, TCHAR_TO_UTF8( *HapiString ),
+            GeoId, PartId, TCHAR_TO_UTF8( *HapiString ),
             AttributeOwner, &AttrInfo ) )
             continue;
 
@@ -343,6 +343,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** HAPI : Create curve for input. **/
         static bool HapiCreateCurveNode( HAPI_NodeId & CurveNodeId );
 
+        /** HAPI : Return true if given node is a valid curve SOP, as created by HapiCreateCurveNode. **/
+        static bool HapiIsCurveNode( HAPI_NodeId NodeId );
+
         /** HAPI : Retrieve the asset node's object transform. **/
         static bool HapiGetAssetTransform( HAPI_NodeId AssetId, FTransform & InTransform );
 
@@ -359,13 +362,14 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         static bool HapiGetObjectTransforms( HAPI_NodeId AssetId, TArray< HAPI_Transform > & ObjectTransforms );
 
         /** HAPI : Marshalling, extract landscape geometry and upload it. Return true on success. **/
+        /** When the whole landscape is sent as a heightfield, its volumes are recorded in OutHeightfieldState if provided. **/
         static bool HapiCreateInputNodeForLandscape(
             const HAPI_NodeId& HostAssetId, ALandscapeProxy * LandscapeProxy,
             HAPI_NodeId & ConnectedAssetId, TArray< HAPI_NodeId >& OutCreatedNodeIds,
             const bool& bExportOnlySelected, const bool& bExportCurves, const bool& bExportMaterials,
             const bool& bExportAsMesh, const bool& bExportLighting, const bool& bExportNormalizedUVs,
             const bool& bExportTileUVs, const FBox& AssetBounds, const bool& bExportAsHeightfield,
-            const bool& bAutoSelectComponents );
+            const bool& bAutoSelectComponents, FHoudiniLandscapeHeightfieldState * OutHeightfieldState = nullptr );
 
         /** HAPI : Marshaling, extract geometry and create input asset for it - return true on success **/
         static bool HapiCreateInputNodeForStaticMesh(
@@ -412,6 +416,16 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             TArray<FVector>* Scales3d = nullptr,
             TArray<float>* UniformScales = nullptr);
 
+        /** HAPI : Marshaling, create an input node holding a linear curve, with positions, rotations and scales set **/
+        /** directly as point attributes. The node is only cooked once - return true on success. **/
+        static bool HapiCreateCurveInputNodeForAttributes(
+            HAPI_NodeId HostAssetId,
+            HAPI_NodeId & ConnectedAssetId,
+            const TArray< FVector > & Positions,
+            const TArray< FQuat > * Rotations = nullptr,
+            const TArray< FVector > * Scales3d = nullptr,
+            const TArray< float > * UniformScales = nullptr );
+
         /** HAPI : Marshaling, disconnect input asset from a given slot. **/
         static bool HapiDisconnectAsset( HAPI_NodeId HostAssetId, int32 InputIndex );
 
@@ -536,13 +550,16 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const FHoudiniGeoPartObject & HoudiniGeoPartObject,
             TArray< FTransform > & Transforms );
 
-        /** HAPI : Given vertex list, retrieve new vertex list for a specified group.                                   **/
-        /** Return number of processed valid index vertices for this split.                                             **/
-        static int32 HapiGetVertexListForGroup(
+        /** HAPI : Retrieve the faces of a specified group, and mark them in the bitmap of faces owned by a group.     **/
+        /** Return number of valid index vertices for this split.                                                       **/
+        static int32 HapiGetFaceListForGroup(
             HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
-            HAPI_PartId PartId, const FString & GroupName, const TArray< int32 > & FullVertexList,
-            TArray< int32 > & NewVertexList, TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
-            TArray< int32 > & AllCollisionFaceIndices, const bool& isPackedPrim );
+            HAPI_PartId PartId, const FString & GroupName, TArray< int32 > & FaceList,
+            TBitArray<> & OwnedFaces );
+
+        /** Expand the faces of a split to a vertex list the size of the part vertex list, unused vertices are -1.      **/
+        static void GetVertexListForFaces(
+            const TArray< int32 > & FullVertexList, const TArray< int32 > & FaceList, TArray< int32 > & NewVertexList );
 
         /** HAPI : Retrieves the mesh sockets list for the current part							**/
         static int32 AddMeshSocketToList(
@@ -681,6 +698,15 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
 
     protected:
 
+        /** HAPI : Marshaling, extract geometry and upload it to a new input node, bypassing the input mesh cache. **/
+        static bool HapiUploadStaticMeshInputNode(
+            UStaticMesh * Mesh,
+            HAPI_NodeId & ConnectedAssetId,
+            TArray< HAPI_NodeId >& OutCreatedNodeIds,
+            class UStaticMeshComponent* StaticMeshComponent,
+            const bool& ExportAllLODs,
+            const bool& ExportSockets );
+
 #if WITH_EDITOR
 
         /** Reset streams used by the given RawMesh. **/
@@ -690,6 +716,13 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
 
     public:
 
+#if WITH_EDITOR
+
+        /** Delete the pooled staging buffers used to upload input meshes. **/
+        static void FreeInputMeshStagingBuffers();
+
+#endif // WITH_EDITOR
+
         /** How many GUID symbols are used for package component name generation. **/
         static const int32 PackageGUIDComponentNameLength;
 
@@ -36,6 +36,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniPluginSerializationVersion.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniEngineAttributeDirectory.h"
 
 uint32
 GetTypeHash( const FHoudiniGeoPartObject & HoudiniGeoPartObject )
@@ -86,6 +87,7 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject()
     , GeoId( -1 )
     , PartId( -1 )
     , SplitId( 0 )
+    , ContentHash( 0u )
     , bIsVisible( true )
     , bIsInstancer( false )
     , bIsCurve( false )
@@ -123,6 +125,7 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject(
     , GeoId( InGeoId )
     , PartId( InPartId )
     , SplitId( 0 )
+    , ContentHash( 0u )
     , bIsVisible( true )
     , bIsInstancer( false )
     , bIsCurve( false )
@@ -161,6 +164,7 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject(
     , GeoId( GeoInfo.nodeId )
     , PartId( PartInfo.id )
     , SplitId( 0 )
+    , ContentHash( 0u )
     , bIsVisible( ObjectInfo.isVisible )
     , bIsInstancer( ObjectInfo.isInstancer )
     , bIsCurve( PartInfo.type == HAPI_PARTTYPE_CURVE )
@@ -201,6 +205,7 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject(
     , GeoId( InGeoId )
     , PartId( InPartId )
     , SplitId( 0 )
+    , ContentHash( 0u )
     , bIsVisible( true )
     , bIsInstancer( false )
     , bIsCurve( false )
@@ -237,6 +242,7 @@ FHoudiniGeoPartObject::FHoudiniGeoPartObject( const FHoudiniGeoPartObject & GeoP
     , GeoId( GeoPartObject.GeoId )
     , PartId( GeoPartObject.PartId )
     , SplitId( GeoPartObject.SplitId )
+    , ContentHash( GeoPartObject.ContentHash )
     , bIsVisible( GeoPartObject.bIsVisible )
     , bIsInstancer( GeoPartObject.bIsInstancer )
     , bIsCurve( GeoPartObject.bIsCurve )
@@ -464,6 +470,9 @@ FHoudiniGeoPartObject::Serialize( FArchive & Ar )
         }
     }
 
+    if ( HoudiniGeoPartObjectVersion >= VER_HOUDINI_PLUGIN_SERIALIZATION_VERSION_GEO_PART_CONTENT_HASH )
+        Ar << ContentHash;
+
     if ( Ar.IsLoading() )
         bIsLoaded = true;
 
@@ -570,17 +579,7 @@ FHoudiniGeoPartObject::HapiCheckAttributeExistance(
     HAPI_NodeId OtherAssetId, const char * AttributeName,
     HAPI_AttributeOwner AttributeOwner ) const
 {
-    HAPI_AttributeInfo AttributeInfo;
-    FMemory::Memset< HAPI_AttributeInfo >( AttributeInfo, 0 );
-
-    if ( FHoudiniApi::GetAttributeInfo(
-        FHoudiniEngine::Get().GetSession(), GeoId, PartId, AttributeName,
-        AttributeOwner, &AttributeInfo ) == HAPI_RESULT_SUCCESS )
-    {
-        return AttributeInfo.exists;
-    }
-
-    return false;
+    return FHoudiniEngineAttributeDirectory::HasAttribute( GeoId, PartId, AttributeName, AttributeOwner );
 }
 
 bool
@@ -1285,17 +1284,8 @@ FHoudiniGeoPartObject::HapiGetAttributeInfo(
     HAPI_NodeId OtherAssetId, const char * AttributeName,
     HAPI_AttributeOwner AttributeOwner, HAPI_AttributeInfo & AttributeInfo ) const
 {
-    FMemory::Memset< HAPI_AttributeInfo >( AttributeInfo, 0 );
-
-    if ( FHoudiniApi::GetAttributeInfo(
-        FHoudiniEngine::Get().GetSession(),
-        GeoId, PartId, AttributeName, AttributeOwner,
-        &AttributeInfo ) == HAPI_RESULT_SUCCESS )
-    {
-         return true;
-    }
-
-    return false;
+    return FHoudiniEngineAttributeDirectory::GetAttributeInfo(
+        GeoId, PartId, AttributeName, AttributeOwner, AttributeInfo );
 }
 
 bool
@@ -1346,17 +1336,10 @@ FHoudiniGeoPartObject::HapiGetAttributeInfo(
     HAPI_NodeId OtherAssetId, const char * AttributeName,
     HAPI_AttributeInfo & AttributeInfo ) const
 {
-    for ( int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx )
+    if ( !HapiGetAttributeInfo( OtherAssetId, AttributeName, HAPI_ATTROWNER_INVALID, AttributeInfo ) )
     {
-        if ( !HapiGetAttributeInfo(
-            OtherAssetId, AttributeName, (HAPI_AttributeOwner) AttrIdx, AttributeInfo ) )
-        {
-            AttributeInfo.exists = false;
-            return false;
-        }
-
-        if ( AttributeInfo.exists )
-            break;
+        AttributeInfo.exists = false;
+        return false;
     }
 
     return true;
@@ -1755,13 +1738,10 @@ FHoudiniGeoPartObject::HapiGetAttributeDataAsString(
         GeoId, PartId, AttributeName, &ResultAttributeInfo,
         &StringHandles[ 0 ], 0, ResultAttributeInfo.count ) == HAPI_RESULT_SUCCESS )
     {
-        for ( int32 Idx = 0, Num = StringHandles.Num(); Idx < Num; ++Idx )
-        {
-            FString HapiString = TEXT( "" );
-            FHoudiniEngineString HoudiniEngineString( StringHandles[ Idx ] );
-            HoudiniEngineString.ToFString( HapiString );
-            AttributeData.Add( HapiString );
-        }
+        // Resolve the handles through the cook's string cache, each unique handle is only fetched once.
+        TArray< FString > HapiStrings;
+        FHoudiniEngineStringCache::ResolveHandles( StringHandles, HapiStrings );
+        AttributeData.Append( HapiStrings );
 
         return true;
     }
@@ -1989,64 +1969,7 @@ FHoudiniGeoPartObject::HapiGetAttributeNames(
     HAPI_NodeId OtherAssetId, HAPI_AttributeOwner AttributeOwner,
     TArray< FString > & AttributeNames ) const
 {
-    AttributeNames.Empty();
-    int32 AttributeCount = 0;
-
-    switch ( AttributeOwner)
-    {
-        case HAPI_ATTROWNER_POINT:
-        {
-            AttributeCount = HapiPartGetPointAttributeCount( OtherAssetId );
-            break;
-        }
-
-        case HAPI_ATTROWNER_VERTEX:
-        {
-            AttributeCount = HapiPartGetVertexAttributeCount( OtherAssetId );
-            break;
-        }
-
-        case HAPI_ATTROWNER_PRIM:
-        {
-            AttributeCount = HapiPartGetPrimitiveAttributeCount( OtherAssetId );
-            break;
-        }
-
-        case HAPI_ATTROWNER_DETAIL:
-        {
-            AttributeCount = HapiPartGetDetailAttributeCount( OtherAssetId );
-            break;
-        }
-
-        default:
-        {
-            return false;
-        }
-    }
-
-    if ( AttributeCount > 0 )
-    {
-        TArray< HAPI_StringHandle > AttributeNameHandles;
-        AttributeNameHandles.SetNumUninitialized( AttributeCount );
-
-        if ( FHoudiniApi::GetAttributeNames(
-            FHoudiniEngine::Get().GetSession(), GeoId, PartId,
-            AttributeOwner, &AttributeNameHandles[ 0 ],
-            AttributeCount ) != HAPI_RESULT_SUCCESS )
-        {
-            return false;
-        }
-
-        for ( int32 Idx = 0, Num = AttributeNameHandles.Num(); Idx < Num; ++Idx )
-        {
-            FString HapiString = TEXT( "" );
-            FHoudiniEngineString HoudiniEngineString( AttributeNameHandles[ Idx ] );
-            if ( HoudiniEngineString.ToFString( HapiString ) )
-                AttributeNames.Add( HapiString );
-        }
-    }
-
-    return true;
+    return FHoudiniEngineAttributeDirectory::GetAttributeNames( GeoId, PartId, AttributeOwner, AttributeNames );
 }
 
 bool
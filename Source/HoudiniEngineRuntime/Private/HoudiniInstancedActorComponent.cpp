@@ -27,6 +27,8 @@
 #include "HoudiniInstancedActorComponent.h"
 #include "HoudiniMeshSplitInstancerComponent.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniRuntimeSettings.h"
+#include "Async/ParallelFor.h"
 #if WITH_EDITOR
 #include "LevelEditorViewport.h"
 #endif
@@ -37,6 +39,7 @@
 UHoudiniInstancedActorComponent::UHoudiniInstancedActorComponent(const class FPostConstructInitializeProperties& PCIP)
 	: Super(PCIP)
 , InstancedAsset( nullptr )
+, InstancesAsset( nullptr )
 {
 }
 
@@ -55,6 +58,10 @@ UHoudiniInstancedActorComponent::Serialize( FArchive & Ar )
 
     Ar << InstancedAsset;
     Ar << Instances;
+
+    // Saved instances were spawned from the saved asset.
+    if ( Ar.IsLoading() )
+        InstancesAsset = InstancedAsset;
 }
 
 void 
@@ -63,6 +70,7 @@ UHoudiniInstancedActorComponent::AddReferencedObjects( UObject * InThis, FRefere
     if ( UHoudiniInstancedActorComponent * This = Cast< UHoudiniInstancedActorComponent >( InThis ) )
     {
         Collector.AddReferencedObject( This->InstancedAsset, This );
+        Collector.AddReferencedObject( This->InstancesAsset, This );
         Collector.AddReferencedObjects( This->Instances, This );
     }
 }
@@ -74,6 +82,14 @@ UHoudiniInstancedActorComponent::SetInstances( const TArray<FTransform>& Instanc
     if ( Instances.Num() || InstanceTransforms.Num() )
     {
         const FScopedTransaction Transaction( LOCTEXT( "UpdateInstances", "Update Instances" ) );
+
+        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+        if ( InstancedAsset && HoudiniRuntimeSettings && HoudiniRuntimeSettings->bReuseInstancedActors )
+        {
+            UpdateInstances( InstanceTransforms );
+            return;
+        }
+
         GetOwner()->Modify();
         ClearInstances();
 
@@ -92,11 +108,69 @@ UHoudiniInstancedActorComponent::SetInstances( const TArray<FTransform>& Instanc
 #endif
 }
 
+#if WITH_EDITOR
+
+void
+UHoudiniInstancedActorComponent::UpdateInstances( const TArray< FTransform > & InstanceTransforms )
+{
+    // Actors spawned from a previous asset cannot be reused.
+    if ( InstancesAsset != InstancedAsset && Instances.Num() > 0 )
+    {
+        Modify();
+        ClearInstances();
+    }
+
+    // Forget about actors which were deleted from the level.
+    if ( Instances.ContainsByPredicate( []( AActor * Instance ) { return !Instance || Instance->IsPendingKill(); } ) )
+    {
+        Modify();
+        Instances.RemoveAll( []( AActor * Instance ) { return !Instance || Instance->IsPendingKill(); } );
+    }
+
+    // Move the actors we keep, only those which actually move are recorded in the transaction.
+    const int32 NumReusedInstances = FMath::Min( Instances.Num(), InstanceTransforms.Num() );
+    for ( int32 InstanceIdx = 0; InstanceIdx < NumReusedInstances; ++InstanceIdx )
+    {
+        AActor * Instance = Instances[ InstanceIdx ];
+        USceneComponent * RootComponent = Instance->GetRootComponent();
+        if ( RootComponent && RootComponent->GetRelativeTransform().Equals( InstanceTransforms[ InstanceIdx ] ) )
+            continue;
+
+        Instance->Modify();
+        if ( RootComponent )
+            RootComponent->Modify();
+
+        Instance->SetActorRelativeTransform( InstanceTransforms[ InstanceIdx ] );
+    }
+
+    if ( Instances.Num() == InstanceTransforms.Num() )
+        return;
+
+    Modify();
+
+    // Destroy the actors we no longer need.
+    for ( int32 InstanceIdx = Instances.Num() - 1; InstanceIdx >= InstanceTransforms.Num(); --InstanceIdx )
+    {
+        if ( Instances[ InstanceIdx ] )
+            Instances[ InstanceIdx ]->Destroy();
+    }
+
+    if ( Instances.Num() > InstanceTransforms.Num() )
+        Instances.SetNum( InstanceTransforms.Num() );
+
+    // And spawn the missing ones.
+    for ( int32 InstanceIdx = Instances.Num(); InstanceIdx < InstanceTransforms.Num(); ++InstanceIdx )
+        AddInstance( InstanceTransforms[ InstanceIdx ] );
+}
+
+#endif
+
 int32
 UHoudiniInstancedActorComponent::AddInstance(const FTransform& InstanceTransform)
 {
 	if (AActor * NewActor = SpawnInstancedActor(InstanceTransform))
 	{
+		InstancesAsset = InstancedAsset;
 		NewActor->AttachRootComponentTo(this, NAME_None, EAttachLocation::KeepRelativeOffset);
 		NewActor->SetActorRelativeTransform(InstanceTransform);
 		return Instances.Add(NewActor);
@@ -165,9 +239,9 @@ void UHoudiniInstancedActorComponent::UpdateInstancerComponentInstances(
     auto ProcessOffsets = [&]()
     {
         TArray<FTransform> ProcessedTransforms;
-        ProcessedTransforms.Reserve( InstancedTransforms.Num() );
+        ProcessedTransforms.SetNumUninitialized( InstancedTransforms.Num() );
 
-        for( int32 InstanceIdx = 0; InstanceIdx < InstancedTransforms.Num(); ++InstanceIdx )
+        ParallelFor( InstancedTransforms.Num(), [&]( int32 InstanceIdx )
         {
             FTransform Transform = InstancedTransforms[ InstanceIdx ];
 
@@ -189,18 +263,14 @@ void UHoudiniInstancedActorComponent::UpdateInstancerComponentInstances(
             Transform.SetRotation( TransformRotation );
             Transform.SetScale3D( TransformScale3D );
 
-            ProcessedTransforms.Add( Transform );
-        }
+            ProcessedTransforms[ InstanceIdx ] = Transform;
+        } );
         return ProcessedTransforms;
     };
 
     if( ISMC )
     {
-        ISMC->ClearInstances();
-        for( const auto& Transform : ProcessOffsets() )
-        {
-            ISMC->AddInstance( Transform );
-        }
+        UpdateInstancedStaticMeshComponent( ISMC, ProcessOffsets() );
     }
     else if( IAC )
     {
@@ -212,4 +282,91 @@ void UHoudiniInstancedActorComponent::UpdateInstancerComponentInstances(
     }
 }
 
+void
+UHoudiniInstancedActorComponent::UpdateInstancedStaticMeshComponent(
+    UInstancedStaticMeshComponent * ISMC, const TArray< FTransform > & InstanceTransforms )
+{
+    const int32 NumInstances = InstanceTransforms.Num();
+    const int32 NumPreviousInstances = ISMC->PerInstanceSMData.Num();
+
+    // Find which of the existing instances need to move.
+    const int32 NumCommonInstances = FMath::Min( NumInstances, NumPreviousInstances );
+    TArray< FMatrix > InstanceMatrices;
+    InstanceMatrices.SetNumUninitialized( NumInstances );
+    TArray< bool > InstanceChanged;
+    InstanceChanged.SetNumUninitialized( NumCommonInstances );
+
+    ParallelFor( NumInstances, [&]( int32 InstanceIdx )
+    {
+        InstanceMatrices[ InstanceIdx ] = InstanceTransforms[ InstanceIdx ].ToMatrixWithScale();
+        if ( InstanceIdx < NumCommonInstances )
+        {
+            InstanceChanged[ InstanceIdx ] =
+                !ISMC->PerInstanceSMData[ InstanceIdx ].Transform.Equals( InstanceMatrices[ InstanceIdx ] );
+        }
+    } );
+
+    if ( ISMC->IsA( UHierarchicalInstancedStaticMeshComponent::StaticClass() ) )
+    {
+        // Hierarchical components maintain a cluster tree along with the instance data, so they have to go through
+        // the per instance API. Only the instances which differ are touched.
+        if ( NumInstances < NumPreviousInstances / 2 )
+        {
+            ISMC->ClearInstances();
+            for ( const FTransform & Transform : InstanceTransforms )
+                ISMC->AddInstance( Transform );
+
+            return;
+        }
+
+        for ( int32 InstanceIdx = 0; InstanceIdx < NumCommonInstances; ++InstanceIdx )
+        {
+            if ( InstanceChanged[ InstanceIdx ] )
+                ISMC->UpdateInstanceTransform( InstanceIdx, InstanceTransforms[ InstanceIdx ], false );
+        }
+
+        for ( int32 InstanceIdx = NumPreviousInstances - 1; InstanceIdx >= NumInstances; --InstanceIdx )
+            ISMC->RemoveInstance( InstanceIdx );
+
+        for ( int32 InstanceIdx = NumPreviousInstances; InstanceIdx < NumInstances; ++InstanceIdx )
+            ISMC->AddInstance( InstanceTransforms[ InstanceIdx ] );
+
+        return;
+    }
+
+    const bool bResized = NumInstances != NumPreviousInstances;
+    if ( bResized )
+    {
+        // Start from an empty component so that all per instance state is reset consistently.
+        ISMC->ClearInstances();
+        ISMC->PerInstanceSMData.SetNum( NumInstances );
+    }
+
+    // Write the instance data in one pass.
+    bool bInstancesChanged = bResized;
+    for ( int32 InstanceIdx = 0; InstanceIdx < NumInstances; ++InstanceIdx )
+    {
+        if ( !bResized && !InstanceChanged[ InstanceIdx ] )
+            continue;
+
+        FInstancedStaticMeshInstanceData & InstanceData = ISMC->PerInstanceSMData[ InstanceIdx ];
+        InstanceData.Transform = InstanceMatrices[ InstanceIdx ];
+        if ( bResized )
+        {
+            InstanceData.LightmapUVBias = FVector2D( -1.0f, -1.0f );
+            InstanceData.ShadowmapUVBias = FVector2D( -1.0f, -1.0f );
+        }
+
+        bInstancesChanged = true;
+    }
+
+    if ( !bInstancesChanged )
+        return;
+
+    // Rendering and physics are only updated once for the whole batch.
+    ISMC->MarkRenderStateDirty();
+    if ( ISMC->bPhysicsStateCreated )
+        ISMC->RecreatePhysicsState();
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -54,6 +54,11 @@ public:
     /** Set the instances. Transforms are given in local space of this component. */
     void SetInstances( const TArray<FTransform>& InstanceTransforms );
 
+#if WITH_EDITOR
+    /** Update the instances, reusing existing actors. Only the difference in count is spawned or destroyed. */
+    void UpdateInstances( const TArray<FTransform>& InstanceTransforms );
+#endif
+
     /** Add an instance to this component. Transform is given in local space of this component. */
     int32 AddInstance( const FTransform& InstanceTransform );
     
@@ -71,6 +76,11 @@ public:
         const FRotator & RotationOffset,
         const FVector & ScaleOffset );
 
+    /** Update the instances of an instanced static mesh component, only instances which have changed are updated. **/
+    static void UpdateInstancedStaticMeshComponent(
+        class UInstancedStaticMeshComponent * ISMC,
+        const TArray< FTransform > & InstanceTransforms );
+
 	//JC: is SkipSerialization the same as Transient?
     //UPROPERTY( SkipSerialization, VisibleAnywhere, Category = Instances )
 	UPROPERTY(Transient, VisibleAnywhere, Category = Instances)
@@ -81,4 +91,10 @@ public:
 	UPROPERTY(Transient, VisibleInstanceOnly, Category = Instances)
     TArray< AActor* > Instances;
 
+protected:
+
+    /** Asset the current instances were spawned from, they can only be reused for this asset. **/
+    UPROPERTY( Transient )
+    UObject* InstancesAsset;
+
 };
@@ -49,6 +49,7 @@
 #include "Landscape/LandscapeMeshCollisionComponent.h"
 #include "Landscape/LandscapeMaterialInstanceConstant.h"
 #include "Landscape/LandscapeSplinesComponent.h"
+#include "Materials/Material.h"
 
 //#include "LandscapeInfo.h"
 //#include "LandscapeComponent.h"
@@ -57,12 +58,144 @@
 //#include "Runtime/Engine/Classes/Landscape/Landscape.h"
 
 #include "LightMap.h"
+#include "Async/ParallelFor.h"
 //#include "Engine/MapBuildDataRegistry.h"
 #if WITH_EDITOR
     #include "FileHelpers.h"
     #include "EngineUtils.h"
 #endif
 
+/** Size of the square tiles used when transposing heightfield data. **/
+static const int32 HoudiniLandscapeTransposeTileSize = 64;
+
+/** Transpose SrcRows x SrcCols values into SrcCols x SrcRows values, converting each of them. Houdini volumes and **/
+/** Unreal landscapes store their samples in transposed order. The data is processed in square tiles so that reads and **/
+/** writes both stay in cache, and rows of tiles are converted in parallel. **/
+template< typename SrcType, typename DestType, typename ConvertFunction >
+static void
+HoudiniLandscapeTransposeConvert(
+    const SrcType * Src, int32 SrcRows, int32 SrcCols, DestType * Dest, ConvertFunction Convert )
+{
+    const int32 TileSize = HoudiniLandscapeTransposeTileSize;
+    const int32 NumTileRows = ( SrcCols + TileSize - 1 ) / TileSize;
+
+    ParallelFor( NumTileRows, [ & ]( int32 TileRow )
+    {
+        const int32 DestRowStart = TileRow * TileSize;
+        const int32 DestRowEnd = FMath::Min( DestRowStart + TileSize, SrcCols );
+
+        for ( int32 DestColStart = 0; DestColStart < SrcRows; DestColStart += TileSize )
+        {
+            const int32 DestColEnd = FMath::Min( DestColStart + TileSize, SrcRows );
+            for ( int32 DestRow = DestRowStart; DestRow < DestRowEnd; ++DestRow )
+            {
+                DestType * RESTRICT DestLine = Dest + DestRow * SrcRows;
+                const SrcType * RESTRICT SrcColumn = Src + DestRow;
+
+                for ( int32 DestCol = DestColStart; DestCol < DestColEnd; ++DestCol )
+                    DestLine[ DestCol ] = Convert( SrcColumn[ DestCol * SrcCols ] );
+            }
+        }
+    } );
+}
+
+/** Convert a region of Unreal integer values to Houdini float values with a mapping computed on the whole landscape. **/
+/** Returns false if a value is outside of the mapping's range, as the whole volume would then need to be rescaled. **/
+template< typename IntType >
+static bool
+HoudiniLandscapeConvertRegion(
+    const TArray< IntType > & IntValues, int32 XSize, int32 YSize,
+    const FHoudiniLandscapeValueMapping & Mapping, TArray< float > & FloatValues )
+{
+    if ( IntValues.Num() != XSize * YSize )
+        return false;
+
+    for ( const IntType & Value : IntValues )
+    {
+        if ( !Mapping.Contains( Value ) )
+            return false;
+    }
+
+    // We need to invert X/Y when reading the value from Unreal
+    FloatValues.SetNumUninitialized( IntValues.Num() );
+    HoudiniLandscapeTransposeConvert(
+        IntValues.GetData(), YSize, XSize, FloatValues.GetData(),
+        [ &Mapping ]( IntType Value ) -> float
+        {
+            return Mapping.Convert( Value );
+        } );
+
+    return true;
+}
+
+/** Compare a region of values against the same region in a larger array, whose rows are Stride values apart. **/
+template< typename ValueType >
+static bool
+HoudiniLandscapeRegionEquals(
+    const ValueType * RegionValues, const ValueType * Values,
+    int32 RegionXSize, int32 RegionYSize, int32 Stride )
+{
+    for ( int32 Y = 0; Y < RegionYSize; Y++ )
+    {
+        if ( FMemory::Memcmp( RegionValues + Y * RegionXSize, Values + Y * Stride, RegionXSize * sizeof( ValueType ) ) != 0 )
+            return false;
+    }
+
+    return true;
+}
+
+FHoudiniLandscapeValueMapping::FHoudiniLandscapeValueMapping()
+    : IntMin( 0 )
+    , IntMax( 0 )
+    , FloatMin( 0.0 )
+    , FloatSpacing( 0.0 )
+{}
+
+bool
+FHoudiniLandscapeValueMapping::Contains( int32 Value ) const
+{
+    return ( Value >= IntMin ) && ( Value <= IntMax );
+}
+
+float
+FHoudiniLandscapeValueMapping::Convert( int32 Value ) const
+{
+    double DoubleValue = ( (double)Value - (double)IntMin ) * FloatSpacing + FloatMin;
+    return (float)DoubleValue;
+}
+
+FHoudiniLandscapeHeightfieldState::FVolume::FVolume()
+    : NodeId( -1 )
+    , DisplayNodeId( -1 )
+{}
+
+FHoudiniLandscapeHeightfieldState::FHoudiniLandscapeHeightfieldState()
+    : MinX( 0 )
+    , MinY( 0 )
+    , MaxX( 0 )
+    , MaxY( 0 )
+    , NumLayers( 0 )
+    , TileSize( 0 )
+{}
+
+bool
+FHoudiniLandscapeHeightfieldState::IsValid() const
+{
+    return Landscape.IsValid() && ( Volumes.Num() > 0 );
+}
+
+void
+FHoudiniLandscapeHeightfieldState::Reset()
+{
+    Landscape.Reset();
+    Transform = FTransform::Identity;
+    MinX = MinY = MaxX = MaxY = 0;
+    NumLayers = 0;
+    TileSize = 0;
+    Volumes.Empty();
+    DirtyComponents.Empty();
+}
+
 void
 FHoudiniLandscapeUtils::GetHeightfieldsInArray(
     const TArray< FHoudiniGeoPartObject >& InArray,
@@ -431,24 +564,21 @@ FHoudiniLandscapeUtils::ConvertHeightfieldDataToLandscapeData(
     int32 YSize = HoudiniXSize;
     IntHeightData.SetNumUninitialized( SizeInPoints );
 
-    int32 nUnreal = 0;
-    for ( int32 nY = 0; nY < YSize; nY++ )
-    {
-        for ( int32 nX = 0; nX < XSize; nX++ )
+    // We need to invert X/Y when reading the value from Houdini
+    const double DoubleFloatMin = (double)FloatMin;
+    HoudiniLandscapeTransposeConvert(
+        HeightfieldFloatValues.GetData(), XSize, HoudiniXSize, IntHeightData.GetData(),
+        [ DoubleFloatMin, ZSpacing, DigitCenterOffset ]( float Value ) -> uint16
         {
-            // We need to invert X/Y when reading the value from Houdini
-            int32 nHoudini = nY + nX * HoudiniXSize;
-
             // Get the double values in [0 - ZRange]
-            double DoubleValue = (double)HeightfieldFloatValues[ nHoudini ] - (double)FloatMin;
+            double DoubleValue = (double)Value - DoubleFloatMin;
 
             // Then convert it to [0 - DesiredRange] and center it 
             DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
 
             //dValue = FMath::Clamp(dValue, 0.0, 65535.0);
-            IntHeightData[ nUnreal++ ] = FMath::RoundToInt( DoubleValue );
-        }
-    }
+            return (uint16)FMath::RoundToInt( DoubleValue );
+        } );
 
     //--------------------------------------------------------------------------------------------------
     // 2. Resample / Pad the int data so that if fits unreal size requirements
@@ -560,24 +690,21 @@ bool FHoudiniLandscapeUtils::ConvertHeightfieldLayerToLandscapeLayer(
     double LayerZRange = ( LayerMax - LayerMin );
     double LayerZSpacing = ( LayerZRange != 0.0 ) ? ( 255.0 / (double)( LayerZRange ) ) : 0.0;
 
-    int32 nUnrealIndex = 0;
-    for ( int32 nY = 0; nY < LayerYSize; nY++ )
-    {
-        for ( int32 nX = 0; nX < LayerXSize; nX++ )
+    // We need to invert X/Y when reading the value from Houdini
+    const double DoubleLayerMin = (double)LayerMin;
+    HoudiniLandscapeTransposeConvert(
+        FloatLayerData.GetData(), LayerXSize, HoudiniXSize, LayerData.GetData(),
+        [ DoubleLayerMin, LayerZSpacing ]( float Value ) -> uint8
         {
-            // We need to invert X/Y when reading the value from Houdini
-            int32 nHoudini = nY + nX * HoudiniXSize;
-
             // Get the double values in [0 - ZRange]
-            double DoubleValue = (double)FloatLayerData[ nHoudini ] - (double)LayerMin;
+            double DoubleValue = (double)Value - DoubleLayerMin;
 
             // Then convert it to [0 - 255]
             DoubleValue *= LayerZSpacing;
 
             //dValue = FMath::Clamp(dValue, 0.0, 65535.0);
-            LayerData[ nUnrealIndex++ ] = FMath::RoundToInt( DoubleValue );
-        }
-    }
+            return (uint8)FMath::RoundToInt( DoubleValue );
+        } );
 
     // Finally, we need to resize the data to fit with the new landscape size
     return FHoudiniLandscapeUtils::ResizeLayerDataForLandscape(
@@ -979,8 +1106,12 @@ FHoudiniLandscapeUtils::ResizeLayerDataForLandscape(
 #if WITH_EDITOR
 bool
 FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape(
-    ALandscapeProxy* LandscapeProxy, const HAPI_NodeId& InputMergeNodeId )
+    ALandscapeProxy* LandscapeProxy, const HAPI_NodeId& InputMergeNodeId,
+    FHoudiniLandscapeHeightfieldState* OutState )
 {
+    if ( OutState )
+        OutState->Reset();
+
     if ( !LandscapeProxy )
         return false;
 
@@ -1009,9 +1140,13 @@ FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape(
     HAPI_VolumeInfo HeightfieldVolumeInfo;
     FTransform LandscapeTransform = Landscape->LandscapeActorToWorld();
 
+    // Keep track of the created volumes so the modified components can be sent later on
+    TArray< FHoudiniLandscapeHeightfieldState::FVolume > CreatedVolumes;
+    FHoudiniLandscapeHeightfieldState::FVolume HeightVolume;
+
     if ( !ConvertLandscapeDataToHeightfieldData(
         HeightData, XSize, YSize, Min, Max, LandscapeTransform,
-        HeightfieldFloatValues, HeightfieldVolumeInfo ) )
+        HeightfieldFloatValues, HeightfieldVolumeInfo, &HeightVolume.Mapping ) )
         return false;
 
     //--------------------------------------------------------------------------------------------------
@@ -1031,6 +1166,13 @@ FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape(
     if ( !CommitVolumeInputNode( VolumeNodeId, InputMergeNodeId, MergeInputIndex++ ) )
         return false;
 
+    // Keep the display nodes and the tile size of the committed volumes for the tile updates
+    int32 VolumeTileSize = 0;
+    bool bCanUpdateTiles = GetVolumeDisplayInfo( VolumeNodeId, PartId, HeightVolume.DisplayNodeId, VolumeTileSize );
+
+    HeightVolume.NodeId = VolumeNodeId;
+    CreatedVolumes.Add( HeightVolume );
+
     //--------------------------------------------------------------------------------------------------
     // 4. Extract and convert all the layers
     //--------------------------------------------------------------------------------------------------
@@ -1053,9 +1195,10 @@ FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape(
         // If the layer came from Houdini, additionnal info might have been stored in the DebugColor
         HAPI_VolumeInfo CurrentLayerVolumeInfo;
         TArray < float > CurrentLayerFloatData;
+        FHoudiniLandscapeHeightfieldState::FVolume LayerVolume;
         if ( !ConvertLandscapeLayerDataToHeightfieldData(
             CurrentLayerIntData, XSize, YSize, LayerUsageDebugColor,
-            CurrentLayerFloatData, CurrentLayerVolumeInfo ) )
+            CurrentLayerFloatData, CurrentLayerVolumeInfo, &LayerVolume.Mapping ) )
             continue;
 
         // We reuse the height's transform
@@ -1075,6 +1218,16 @@ FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape(
 
         MergeInputIndex++;
 
+        // A committed layer that can't be updated by tiles prevents the incremental updates
+        int32 LayerTileSize = 0;
+        if ( !GetVolumeDisplayInfo( LayerVolumeNodeId, PartId, LayerVolume.DisplayNodeId, LayerTileSize )
+            || LayerTileSize != VolumeTileSize )
+            bCanUpdateTiles = false;
+
+        LayerVolume.NodeId = LayerVolumeNodeId;
+        LayerVolume.LayerInfo = LandscapeInfo->Layers[ n ].LayerInfoObj;
+        CreatedVolumes.Add( LayerVolume );
+
         // Was the mask added?
         if ( LayerName == TEXT("mask") )
             bMaskCreated = true;
@@ -1093,9 +1246,243 @@ FHoudiniLandscapeUtils::CreateHeightfieldFromLandscape(
     if ( !bMaskCreated )
         return false;
 
+    if ( OutState && bCanUpdateTiles )
+    {
+        // The default mask is constant and never needs to be updated, so it isn't tracked
+        OutState->Landscape = Landscape;
+        OutState->Transform = LandscapeTransform;
+        OutState->MinX = MAX_int32;
+        OutState->MinY = MAX_int32;
+        OutState->MaxX = -MAX_int32;
+        OutState->MaxY = -MAX_int32;
+        LandscapeInfo->GetLandscapeExtent( OutState->MinX, OutState->MinY, OutState->MaxX, OutState->MaxY );
+        OutState->NumLayers = NumLayers;
+        OutState->TileSize = VolumeTileSize;
+        OutState->Volumes = MoveTemp( CreatedVolumes );
+    }
+
     return true;
 }
 
+bool
+FHoudiniLandscapeUtils::UpdateHeightfieldFromLandscape( FHoudiniLandscapeHeightfieldState& State )
+{
+    if ( !State.IsValid() )
+        return false;
+
+    ALandscape* Landscape = State.Landscape.Get();
+    ULandscapeInfo* LandscapeInfo = Landscape ? Landscape->GetLandscapeInfo() : nullptr;
+    if ( !LandscapeInfo )
+        return false;
+
+    //--------------------------------------------------------------------------------------------------
+    // 1. Make sure the existing volumes still match the landscape
+    //--------------------------------------------------------------------------------------------------
+    int32 MinX = MAX_int32;
+    int32 MinY = MAX_int32;
+    int32 MaxX = -MAX_int32;
+    int32 MaxY = -MAX_int32;
+    if ( !LandscapeInfo->GetLandscapeExtent( MinX, MinY, MaxX, MaxY ) )
+        return false;
+
+    if ( MinX != State.MinX || MinY != State.MinY || MaxX != State.MaxX || MaxY != State.MaxY )
+        return false;
+
+    if ( LandscapeInfo->Layers.Num() != State.NumLayers )
+        return false;
+
+    if ( !Landscape->LandscapeActorToWorld().Equals( State.Transform ) )
+        return false;
+
+    // The height volume comes first and has no layer
+    TArray< int32 > VolumeLayerIndices;
+    VolumeLayerIndices.Init( INDEX_NONE, State.Volumes.Num() );
+    for ( int32 VolumeIdx = 0; VolumeIdx < State.Volumes.Num(); VolumeIdx++ )
+    {
+        const FHoudiniLandscapeHeightfieldState::FVolume& Volume = State.Volumes[ VolumeIdx ];
+        if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( Volume.NodeId ) || Volume.DisplayNodeId < 0 )
+            return false;
+
+        if ( VolumeIdx == 0 )
+            continue;
+
+        ULandscapeLayerInfoObject* LayerInfo = Volume.LayerInfo.Get();
+        if ( !LayerInfo )
+            return false;
+
+        for ( int32 LayerIdx = 0; LayerIdx < LandscapeInfo->Layers.Num(); LayerIdx++ )
+        {
+            if ( LandscapeInfo->Layers[ LayerIdx ].LayerInfoObj == LayerInfo )
+            {
+                VolumeLayerIndices[ VolumeIdx ] = LayerIdx;
+                break;
+            }
+        }
+
+        if ( VolumeLayerIndices[ VolumeIdx ] == INDEX_NONE )
+            return false;
+    }
+
+    if ( State.DirtyComponents.Num() <= 0 )
+        return true;
+
+    //--------------------------------------------------------------------------------------------------
+    // 2. Get the tile aligned volume regions covering the modified components
+    //--------------------------------------------------------------------------------------------------
+    // Unreal's X/Y are inverted in the volume
+    const int32 TileSize = State.TileSize;
+    if ( TileSize <= 0 )
+        return false;
+
+    const int32 VolumeXSize = State.MaxY - State.MinY + 1;
+    const int32 VolumeYSize = State.MaxX - State.MinX + 1;
+
+    TArray< FIntRect > Regions;
+    int64 RegionsSize = 0;
+    for ( const TWeakObjectPtr< ULandscapeComponent >& DirtyComponent : State.DirtyComponents )
+    {
+        ULandscapeComponent* LandscapeComponent = DirtyComponent.Get();
+        if ( !LandscapeComponent || ( LandscapeComponent->GetLandscapeInfo() != LandscapeInfo ) )
+            continue;
+
+        int32 ComponentMinX = MAX_int32;
+        int32 ComponentMinY = MAX_int32;
+        int32 ComponentMaxX = -MAX_int32;
+        int32 ComponentMaxY = -MAX_int32;
+        LandscapeComponent->GetComponentExtent( ComponentMinX, ComponentMinY, ComponentMaxX, ComponentMaxY );
+
+        FIntRect Region;
+        Region.Min.X = FMath::Max( ( ComponentMinY - State.MinY ) / TileSize * TileSize, 0 );
+        Region.Min.Y = FMath::Max( ( ComponentMinX - State.MinX ) / TileSize * TileSize, 0 );
+        Region.Max.X = FMath::Min( FMath::DivideAndRoundUp( ComponentMaxY - State.MinY + 1, TileSize ) * TileSize, VolumeXSize );
+        Region.Max.Y = FMath::Min( FMath::DivideAndRoundUp( ComponentMaxX - State.MinX + 1, TileSize ) * TileSize, VolumeYSize );
+        if ( ( Region.Width() < 2 ) || ( Region.Height() < 2 ) )
+            continue;
+
+        Regions.Add( Region );
+        RegionsSize += (int64)Region.Width() * (int64)Region.Height();
+    }
+
+    if ( Regions.Num() <= 0 )
+    {
+        State.DirtyComponents.Empty();
+        return true;
+    }
+
+    // Past a certain point, sending the whole volumes at once is cheaper than sending them tile by tile
+    if ( RegionsSize * 2 > (int64)VolumeXSize * (int64)VolumeYSize )
+        return false;
+
+    //--------------------------------------------------------------------------------------------------
+    // 3. Extract and convert the values of all regions before sending anything
+    //--------------------------------------------------------------------------------------------------
+    const int32 NumVolumes = State.Volumes.Num();
+    TArray< TArray< float > > RegionValues;
+    RegionValues.SetNum( Regions.Num() * NumVolumes );
+    for ( int32 RegionIdx = 0; RegionIdx < Regions.Num(); RegionIdx++ )
+    {
+        const FIntRect& Region = Regions[ RegionIdx ];
+        const int32 RegionMinX = State.MinX + Region.Min.Y;
+        const int32 RegionMinY = State.MinY + Region.Min.X;
+        const int32 RegionMaxX = State.MinX + Region.Max.Y - 1;
+        const int32 RegionMaxY = State.MinY + Region.Max.X - 1;
+
+        for ( int32 VolumeIdx = 0; VolumeIdx < NumVolumes; VolumeIdx++ )
+        {
+            const FHoudiniLandscapeValueMapping& Mapping = State.Volumes[ VolumeIdx ].Mapping;
+            TArray< float >& FloatValues = RegionValues[ RegionIdx * NumVolumes + VolumeIdx ];
+
+            int32 XSize = RegionMaxX - RegionMinX + 1;
+            int32 YSize = RegionMaxY - RegionMinY + 1;
+            if ( VolumeIdx == 0 )
+            {
+                TArray< uint16 > HeightData;
+                if ( !GetLandscapeData( LandscapeInfo, RegionMinX, RegionMinY, RegionMaxX, RegionMaxY, HeightData, XSize, YSize ) )
+                    return false;
+
+                if ( !HoudiniLandscapeConvertRegion( HeightData, XSize, YSize, Mapping, FloatValues ) )
+                    return false;
+            }
+            else
+            {
+                TArray< uint8 > LayerData;
+                FLinearColor LayerUsageDebugColor;
+                FString LayerName;
+                if ( !GetLandscapeLayerData(
+                    LandscapeInfo, VolumeLayerIndices[ VolumeIdx ],
+                    RegionMinX, RegionMinY, RegionMaxX, RegionMaxY,
+                    LayerData, LayerUsageDebugColor, LayerName ) )
+                    return false;
+
+                if ( !HoudiniLandscapeConvertRegion( LayerData, XSize, YSize, Mapping, FloatValues ) )
+                    return false;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    // 4. Send the tiles to the existing volumes and recommit them
+    //--------------------------------------------------------------------------------------------------
+    for ( int32 VolumeIdx = 0; VolumeIdx < NumVolumes; VolumeIdx++ )
+    {
+        const FHoudiniLandscapeHeightfieldState::FVolume& Volume = State.Volumes[ VolumeIdx ];
+        for ( int32 RegionIdx = 0; RegionIdx < Regions.Num(); RegionIdx++ )
+        {
+            const FIntRect& Region = Regions[ RegionIdx ];
+            if ( !SetHeightfieldTileData(
+                Volume.DisplayNodeId, 0, TileSize, RegionValues[ RegionIdx * NumVolumes + VolumeIdx ],
+                Region.Min.X, Region.Min.Y, Region.Width(), Region.Height() ) )
+                return false;
+        }
+
+        if ( !CommitVolumeInputNode( Volume.NodeId, -1, -1 ) )
+            return false;
+    }
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Landscape input: updated %d modified components in %d heightfield volumes." ),
+        Regions.Num(), NumVolumes );
+
+    State.DirtyComponents.Empty();
+
+    return true;
+}
+
+void
+FHoudiniLandscapeUtils::MarkHeightfieldComponentsDirty( FHoudiniLandscapeHeightfieldState& State, UObject* Object )
+{
+    if ( !Object || !State.IsValid() )
+        return;
+
+    ALandscape* Landscape = State.Landscape.Get();
+    ULandscapeInfo* LandscapeInfo = Landscape ? Landscape->GetLandscapeInfo() : nullptr;
+    if ( !LandscapeInfo )
+        return;
+
+    if ( ULandscapeComponent* LandscapeComponent = Cast< ULandscapeComponent >( Object ) )
+    {
+        if ( LandscapeComponent->GetLandscapeInfo() == LandscapeInfo )
+            State.DirtyComponents.Add( LandscapeComponent );
+
+        return;
+    }
+
+    // Sculpting and painting modify the heightmap and weightmap textures, which can be shared by several components
+    UTexture2D* Texture = Cast< UTexture2D >( Object );
+    if ( !Texture )
+        return;
+
+    for ( auto& ComponentPair : LandscapeInfo->XYtoComponentMap )
+    {
+        ULandscapeComponent* LandscapeComponent = ComponentPair.Value;
+        if ( !LandscapeComponent )
+            continue;
+
+        if ( ( LandscapeComponent->HeightmapTexture == Texture ) || LandscapeComponent->WeightmapTextures.Contains( Texture ) )
+            State.DirtyComponents.Add( LandscapeComponent );
+    }
+}
+
 bool
 FHoudiniLandscapeUtils::CreateHeightfieldFromLandscapeComponentArray(
     ALandscapeProxy* LandscapeProxy,
@@ -1407,7 +1794,8 @@ FHoudiniLandscapeUtils::ConvertLandscapeDataToHeightfieldData(
     FVector Min, FVector Max, 
     const FTransform& LandscapeTransform,
     TArray<float>& HeightfieldFloatValues,
-    HAPI_VolumeInfo& HeightfieldVolumeInfo)
+    HAPI_VolumeInfo& HeightfieldVolumeInfo,
+    FHoudiniLandscapeValueMapping* OutMapping )
 {
     HeightfieldFloatValues.Empty();
 
@@ -1449,6 +1837,14 @@ FHoudiniLandscapeUtils::ConvertLandscapeDataToHeightfieldData(
     // The factor used to convert from unreal digit range to Houdini's float Range
     double ZSpacing = ( DigitRange != 0.0 ) ? ( FloatRange / DigitRange ) : 0.0;
 
+    if ( OutMapping )
+    {
+        OutMapping->IntMin = IntMin;
+        OutMapping->IntMax = IntMax;
+        OutMapping->FloatMin = ZMin;
+        OutMapping->FloatSpacing = ZSpacing;
+    }
+
     // Use default unreal scaling for marshalling landscapes
     // A lot of precision will be lost in order to keep the same transform as the landscape input
     bool bUseDefaultUE4Scaling = false;
@@ -1459,20 +1855,17 @@ FHoudiniLandscapeUtils::ConvertLandscapeDataToHeightfieldData(
     // Convert the Int data to Float
     HeightfieldFloatValues.SetNumUninitialized( SizeInPoints );
     
-    for ( int32 nY = 0; nY < HoudiniYSize; nY++ )
-    {
-        for ( int32 nX = 0; nX < HoudiniXSize; nX++ )
+    // We need to invert X/Y when reading the value from Unreal
+    const double DoubleIntMin = (double)IntMin;
+    HoudiniLandscapeTransposeConvert(
+        IntHeightData.GetData(), HoudiniXSize, XSize, HeightfieldFloatValues.GetData(),
+        [ DoubleIntMin, ZSpacing, ZMin ]( uint16 Value ) -> float
         {
-            // We need to invert X/Y when reading the value from Unreal
-            int32 nHoudini = nX + nY * HoudiniXSize;
-            int32 nUnreal = nY + nX * XSize;
-
             // Convert the int values to meter
             // Unreal's digit value have a zero value of 32768
-            double DoubleValue = ( (double)IntHeightData[ nUnreal ] - (double)IntMin ) * ZSpacing + ZMin;
-            HeightfieldFloatValues[ nHoudini ] = (float)DoubleValue;
-        }
-    }
+            double DoubleValue = ( (double)Value - DoubleIntMin ) * ZSpacing + ZMin;
+            return (float)DoubleValue;
+        } );
     
     // Verifying the converted ZMin / ZMax
     float FloatMin = HeightfieldFloatValues[ 0 ];
@@ -1562,7 +1955,8 @@ FHoudiniLandscapeUtils::ConvertLandscapeLayerDataToHeightfieldData(
     const int32& XSize, const int32& YSize,
     const FLinearColor& LayerUsageDebugColor,
     TArray<float>& LayerFloatValues,
-    HAPI_VolumeInfo& LayerVolumeInfo)
+    HAPI_VolumeInfo& LayerVolumeInfo,
+    FHoudiniLandscapeValueMapping* OutMapping )
 {
     LayerFloatValues.Empty();
 
@@ -1610,23 +2004,28 @@ FHoudiniLandscapeUtils::ConvertLandscapeLayerDataToHeightfieldData(
 
     LayerSpacing = ( LayerMax - LayerMin ) / DigitRange;
 
+    if ( OutMapping )
+    {
+        OutMapping->IntMin = IntMin;
+        OutMapping->IntMax = IntMax;
+        OutMapping->FloatMin = LayerMin;
+        OutMapping->FloatSpacing = LayerSpacing;
+    }
+
     // Convert the Int data to Float
     LayerFloatValues.SetNumUninitialized( SizeInPoints );
 
-    for ( int32 nY = 0; nY < HoudiniYSize; nY++ )
-    {
-        for ( int32 nX = 0; nX < HoudiniXSize; nX++ )
+    // We need to invert X/Y when reading the value from Unreal
+    const double DoubleIntMin = (double)IntMin;
+    HoudiniLandscapeTransposeConvert(
+        IntHeightData.GetData(), HoudiniXSize, XSize, LayerFloatValues.GetData(),
+        [ DoubleIntMin, LayerSpacing, LayerMin ]( uint8 Value ) -> float
         {
-            // We need to invert X/Y when reading the value from Unreal
-            int32 nHoudini = nX + nY * HoudiniXSize;
-            int32 nUnreal = nY + nX * XSize;
-
             // Convert the int values to meter
             // Unreal's digit value have a zero value of 32768
-            double DoubleValue = ( (double)IntHeightData[ nUnreal ] - (double)IntMin ) * LayerSpacing + LayerMin;
-            LayerFloatValues[ nHoudini ] = (float)DoubleValue;
-        }
-    }
+            double DoubleValue = ( (double)Value - DoubleIntMin ) * LayerSpacing + LayerMin;
+            return (float)DoubleValue;
+        } );
 
     // Verifying the converted ZMin / ZMax
     float FloatMin = LayerFloatValues[ 0 ];
@@ -1715,6 +2114,76 @@ FHoudiniLandscapeUtils::SetHeighfieldData(
     return true;
 }
 
+bool
+FHoudiniLandscapeUtils::GetVolumeDisplayInfo(
+    const HAPI_NodeId& VolumeNodeId, const HAPI_PartId& PartId,
+    HAPI_NodeId& DisplayNodeId, int32& TileSize )
+{
+    HAPI_GeoInfo DisplayGeoInfo;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetGeoInfo(
+        FHoudiniEngine::Get().GetSession(), VolumeNodeId, &DisplayGeoInfo ), false );
+
+    HAPI_VolumeInfo VolumeInfo;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetVolumeInfo(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, PartId, &VolumeInfo ), false );
+
+    if ( VolumeInfo.tileSize <= 0 )
+        return false;
+
+    DisplayNodeId = DisplayGeoInfo.nodeId;
+    TileSize = VolumeInfo.tileSize;
+
+    return true;
+}
+
+bool
+FHoudiniLandscapeUtils::SetHeightfieldTileData(
+    const HAPI_NodeId& DisplayNodeId, const HAPI_PartId& PartId, const int32& TileSize,
+    const TArray< float >& FloatValues,
+    const int32& RegionMinX, const int32& RegionMinY,
+    const int32& RegionXSize, const int32& RegionYSize )
+{
+    // The region has to start on a tile, only the tiles on the volume's border can be partial
+    if ( TileSize <= 0 || ( RegionMinX % TileSize ) != 0 || ( RegionMinY % TileSize ) != 0 )
+        return false;
+
+    if ( FloatValues.Num() != RegionXSize * RegionYSize )
+        return false;
+
+    // Tiles are cubes, heightfields only use their first Z slice
+    TArray< float > TileValues;
+    TileValues.SetNumZeroed( TileSize * TileSize * TileSize );
+
+    HAPI_VolumeTileInfo TileInfo;
+    FMemory::Memzero< HAPI_VolumeTileInfo >( TileInfo );
+    TileInfo.minZ = 0;
+    TileInfo.isValid = true;
+
+    for ( int32 TileY = 0; TileY < RegionYSize; TileY += TileSize )
+    {
+        const int32 TileYSize = FMath::Min( TileSize, RegionYSize - TileY );
+        for ( int32 TileX = 0; TileX < RegionXSize; TileX += TileSize )
+        {
+            const int32 TileXSize = FMath::Min( TileSize, RegionXSize - TileX );
+            for ( int32 Y = 0; Y < TileYSize; Y++ )
+            {
+                FMemory::Memcpy(
+                    &TileValues[ Y * TileSize ],
+                    &FloatValues[ ( TileY + Y ) * RegionXSize + TileX ],
+                    TileXSize * sizeof( float ) );
+            }
+
+            TileInfo.minX = RegionMinX + TileX;
+            TileInfo.minY = RegionMinY + TileY;
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVolumeTileFloatData(
+                FHoudiniEngine::Get().GetSession(),
+                DisplayNodeId, PartId, &TileInfo, TileValues.GetData(), TileValues.Num() ), false );
+        }
+    }
+
+    return true;
+}
+
 bool
 FHoudiniLandscapeUtils::CreateHeightfieldInputNode( HAPI_NodeId& DisplayNodeId, HAPI_NodeId& MergeNodeId, const FString& NodeName )
 {
@@ -2765,6 +3234,55 @@ FHoudiniLandscapeUtils::CreateAllLandscapes(
             XSize, YSize, ImportLayerInfos ) )
             continue;
 
+        // If the landscape previously created for this heightfield still has the same layout,
+        // only the components whose values have changed need to be written
+        ALandscape* PreviousLandscape = ExistingLandscape;
+        if ( !PreviousLandscape )
+            PreviousLandscape = Landscapes.FindRef( *CurrentHeightfield );
+
+        if ( PreviousLandscape && PreviousLandscape->IsValidLowLevel()
+            && UpdateLandscapeRegions(
+                PreviousLandscape, IntHeightData, ImportLayerInfos, LandscapeTransform,
+                XSize, YSize, NumSectionPerLandscapeComponent, NumQuadsPerLandscapeSection ) )
+        {
+            // A landscape without materials gets the heightfield's ones, like a new landscape would. Materials
+            // already on the landscape are kept, as a recreated landscape would keep them from the previous one.
+            // Notifying the change of the material properties updates the components' material instances.
+            for ( int32 MaterialIdx = 0; MaterialIdx < 2; MaterialIdx++ )
+            {
+                UMaterialInterface* NewMaterial = ( MaterialIdx == 0 ) ? LandscapeMaterial : LandscapeHoleMaterial;
+                UMaterialInterface*& CurrentMaterial = ( MaterialIdx == 0 ) ?
+                    PreviousLandscape->LandscapeMaterial : PreviousLandscape->LandscapeHoleMaterial;
+
+                if ( !NewMaterial || ( CurrentMaterial == NewMaterial ) )
+                    continue;
+
+                if ( CurrentMaterial && ( CurrentMaterial != UMaterial::GetDefaultMaterial( MD_Surface ) ) )
+                    continue;
+
+                CurrentMaterial = NewMaterial;
+
+                UProperty* FoundProperty = FindField< UProperty >(
+                    PreviousLandscape->GetClass(), ( MaterialIdx == 0 ) ? TEXT( "LandscapeMaterial" ) : TEXT( "LandscapeHoleMaterial" ) );
+                if ( FoundProperty )
+                {
+                    FPropertyChangedEvent PropChanged( FoundProperty, EPropertyChangeType::ValueSet );
+                    PreviousLandscape->PostEditChangeProperty( PropChanged );
+                }
+                else
+                {
+                    PreviousLandscape->PostEditChange();
+                }
+            }
+
+            // Keep the landscape, and remove it from the old map to avoid its destruction
+            NewLandscapes.Add( *CurrentHeightfield, PreviousLandscape );
+            if ( Landscapes.FindRef( *CurrentHeightfield ) == PreviousLandscape )
+                Landscapes.Remove( *CurrentHeightfield );
+
+            continue;
+        }
+
 		ALandscape* CurrentLandscape = nullptr;
 
 		if (ExistingLandscape != nullptr && ExistingLandscape->IsValidLowLevel())
@@ -2975,12 +3493,184 @@ bool FHoudiniLandscapeUtils::UpdateLandscape(
 
 	ExistingLandscape->GetWorld()->ForceGarbageCollection(true);
 
-	// Set the landscape Transform
+	// Set the landscape Transform
 	ExistingLandscape->SetActorTransform(LandscapeTransform);
 
 	return true;
 }
 
+bool
+FHoudiniLandscapeUtils::UpdateLandscapeRegions(
+    ALandscape* ExistingLandscape,
+    const TArray< uint16 >& IntHeightData,
+    const TArray< FLandscapeImportLayerInfo >& ImportLayerInfos,
+    const FTransform& LandscapeTransform,
+    const int32& XSize, const int32& YSize,
+    const int32& NumSectionPerLandscapeComponent, const int32& NumQuadsPerLandscapeSection )
+{
+    if ( !ExistingLandscape || !ExistingLandscape->IsValidLowLevel() )
+        return false;
+
+    ULandscapeInfo* LandscapeInfo = ExistingLandscape->GetLandscapeInfo();
+    if ( !LandscapeInfo )
+        return false;
+
+    if ( ( XSize < 2 ) || ( YSize < 2 ) || ( IntHeightData.Num() != XSize * YSize ) )
+        return false;
+
+    //--------------------------------------------------------------------------------------------------
+    // 1. The landscape's layout must be identical, only its values can differ
+    //--------------------------------------------------------------------------------------------------
+    if ( ( ExistingLandscape->ComponentSizeQuads != NumSectionPerLandscapeComponent * NumQuadsPerLandscapeSection )
+        || ( ExistingLandscape->NumSubsections != NumSectionPerLandscapeComponent )
+        || ( ExistingLandscape->SubsectionSizeQuads != NumQuadsPerLandscapeSection ) )
+        return false;
+
+    if ( !ExistingLandscape->GetActorTransform().Equals( LandscapeTransform ) )
+        return false;
+
+    int32 MinX = MAX_int32;
+    int32 MinY = MAX_int32;
+    int32 MaxX = -MAX_int32;
+    int32 MaxY = -MAX_int32;
+    if ( !LandscapeInfo->GetLandscapeExtent( MinX, MinY, MaxX, MaxY ) )
+        return false;
+
+    if ( ( MaxX - MinX + 1 != XSize ) || ( MaxY - MinY + 1 != YSize ) )
+        return false;
+
+    // Every layer must already exist on the landscape, with the same blending
+    int32 NumExistingLayers = 0;
+    for ( const FLandscapeInfoLayerSettings& LayerSettings : LandscapeInfo->Layers )
+    {
+        if ( LayerSettings.LayerInfoObj )
+            NumExistingLayers++;
+    }
+
+    if ( NumExistingLayers != ImportLayerInfos.Num() )
+        return false;
+
+    TArray< ULandscapeLayerInfoObject* > LayerInfos;
+    for ( const FLandscapeImportLayerInfo& ImportLayerInfo : ImportLayerInfos )
+    {
+        if ( !ImportLayerInfo.LayerInfo || ( ImportLayerInfo.LayerData.Num() != XSize * YSize ) )
+            return false;
+
+        ULandscapeLayerInfoObject* ExistingLayerInfo = nullptr;
+        for ( const FLandscapeInfoLayerSettings& LayerSettings : LandscapeInfo->Layers )
+        {
+            if ( LayerSettings.LayerInfoObj && ( LayerSettings.GetLayerName() == ImportLayerInfo.LayerName ) )
+            {
+                ExistingLayerInfo = LayerSettings.LayerInfoObj;
+                break;
+            }
+        }
+
+        if ( !ExistingLayerInfo || ( ExistingLayerInfo->bNoWeightBlend != ImportLayerInfo.LayerInfo->bNoWeightBlend ) )
+            return false;
+
+        LayerInfos.Add( ExistingLayerInfo );
+    }
+
+    //--------------------------------------------------------------------------------------------------
+    // 2. Find the component regions whose height or layer values have changed
+    //--------------------------------------------------------------------------------------------------
+    TArray< ULandscapeComponent* > LandscapeComponents;
+    LandscapeInfo->XYtoComponentMap.GenerateValueArray( LandscapeComponents );
+
+    FLandscapeEditDataInterface LandscapeEdit( LandscapeInfo );
+
+    // The regions' max values are inclusive, as expected by the edit interface
+    TArray< FIntRect > ChangedHeightRegions;
+    TArray< TArray< FIntRect > > ChangedLayerRegions;
+    ChangedLayerRegions.SetNum( LayerInfos.Num() );
+    TSet< ULandscapeComponent* > ChangedComponents;
+
+    TArray< uint16 > CurrentHeightData;
+    TArray< uint8 > CurrentLayerData;
+    for ( ULandscapeComponent* LandscapeComponent : LandscapeComponents )
+    {
+        if ( !LandscapeComponent )
+            continue;
+
+        int32 ComponentMinX = MAX_int32;
+        int32 ComponentMinY = MAX_int32;
+        int32 ComponentMaxX = -MAX_int32;
+        int32 ComponentMaxY = -MAX_int32;
+        LandscapeComponent->GetComponentExtent( ComponentMinX, ComponentMinY, ComponentMaxX, ComponentMaxY );
+
+        const FIntRect Region( ComponentMinX, ComponentMinY, ComponentMaxX, ComponentMaxY );
+        const int32 RegionXSize = ComponentMaxX - ComponentMinX + 1;
+        const int32 RegionYSize = ComponentMaxY - ComponentMinY + 1;
+        const int32 RegionOffset = ( ComponentMinY - MinY ) * XSize + ( ComponentMinX - MinX );
+
+        CurrentHeightData.Reset();
+        CurrentHeightData.AddZeroed( RegionXSize * RegionYSize );
+        LandscapeEdit.GetHeightDataFast( ComponentMinX, ComponentMinY, ComponentMaxX, ComponentMaxY, CurrentHeightData.GetData(), 0 );
+        if ( !HoudiniLandscapeRegionEquals(
+            CurrentHeightData.GetData(), IntHeightData.GetData() + RegionOffset, RegionXSize, RegionYSize, XSize ) )
+        {
+            ChangedHeightRegions.Add( Region );
+            ChangedComponents.Add( LandscapeComponent );
+        }
+
+        for ( int32 LayerIdx = 0; LayerIdx < LayerInfos.Num(); LayerIdx++ )
+        {
+            CurrentLayerData.Reset();
+            CurrentLayerData.AddZeroed( RegionXSize * RegionYSize );
+            LandscapeEdit.GetWeightDataFast(
+                LayerInfos[ LayerIdx ], ComponentMinX, ComponentMinY, ComponentMaxX, ComponentMaxY, CurrentLayerData.GetData(), 0 );
+
+            if ( !HoudiniLandscapeRegionEquals(
+                CurrentLayerData.GetData(), ImportLayerInfos[ LayerIdx ].LayerData.GetData() + RegionOffset,
+                RegionXSize, RegionYSize, XSize ) )
+            {
+                ChangedLayerRegions[ LayerIdx ].Add( Region );
+                ChangedComponents.Add( LandscapeComponent );
+            }
+        }
+    }
+
+    // Past a certain point, reimporting the whole landscape is cheaper than updating it component by component
+    if ( ChangedComponents.Num() * 2 > LandscapeComponents.Num() )
+        return false;
+
+    //--------------------------------------------------------------------------------------------------
+    // 3. Write the changed regions, the other components and their collision are left untouched
+    //--------------------------------------------------------------------------------------------------
+    for ( const FIntRect& Region : ChangedHeightRegions )
+    {
+        const int32 RegionOffset = ( Region.Min.Y - MinY ) * XSize + ( Region.Min.X - MinX );
+        LandscapeEdit.SetHeightData(
+            Region.Min.X, Region.Min.Y, Region.Max.X, Region.Max.Y,
+            IntHeightData.GetData() + RegionOffset, XSize, true );
+    }
+
+    for ( int32 LayerIdx = 0; LayerIdx < LayerInfos.Num(); LayerIdx++ )
+    {
+        // The values are written as they are, like an import would
+        for ( const FIntRect& Region : ChangedLayerRegions[ LayerIdx ] )
+        {
+            const int32 RegionOffset = ( Region.Min.Y - MinY ) * XSize + ( Region.Min.X - MinX );
+            LandscapeEdit.SetAlphaData(
+                LayerInfos[ LayerIdx ], Region.Min.X, Region.Min.Y, Region.Max.X, Region.Max.Y,
+                ImportLayerInfos[ LayerIdx ].LayerData.GetData() + RegionOffset, XSize,
+                ELandscapeLayerPaintingRestriction::None, false, false );
+        }
+
+        // Keep the values needed to convert the layer back to Houdini up to date
+        LayerInfos[ LayerIdx ]->LayerUsageDebugColor = ImportLayerInfos[ LayerIdx ].LayerInfo->LayerUsageDebugColor;
+    }
+
+    LandscapeEdit.Flush();
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Updated %d of %d landscape components in place." ),
+        ChangedComponents.Num(), LandscapeComponents.Num() );
+
+    return true;
+}
+
 void FHoudiniLandscapeUtils::GetHeightFieldLandscapeMaterials(
     const FHoudiniGeoPartObject& Heightfield,
     UMaterialInterface*& LandscapeMaterial,
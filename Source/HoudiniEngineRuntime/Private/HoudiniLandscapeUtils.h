@@ -35,6 +35,82 @@
 #include "Runtime/Engine/Classes/Landscape/Landscape.h"
 
 struct FHoudiniCookParams;
+class ULandscapeComponent;
+class ULandscapeLayerInfoObject;
+
+/** Linear mapping used to convert Unreal integer landscape values to Houdini float values. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeValueMapping
+{
+    FHoudiniLandscapeValueMapping();
+
+    /** Returns true if the integer value can be converted without changing the mapping. **/
+    bool Contains( int32 Value ) const;
+
+    /** Converts an integer value to its Houdini float value. **/
+    float Convert( int32 Value ) const;
+
+    /** Range of the integer values the mapping was built from. **/
+    int32 IntMin;
+    int32 IntMax;
+
+    /** Float value of IntMin, and float spacing between two integer values. **/
+    double FloatMin;
+    double FloatSpacing;
+};
+
+/** Heightfield volumes created for a whole landscape input, kept alive so that later edits can be sent as tiles. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeHeightfieldState
+{
+    /** A volume input node and the mapping that was used to fill it. **/
+    struct FVolume
+    {
+        FVolume();
+
+        /** Volume input node. **/
+        HAPI_NodeId NodeId;
+
+        /** Display node of the volume input node, holding the volume part. **/
+        HAPI_NodeId DisplayNodeId;
+
+        /** Layer info of this volume, null for the height volume. **/
+        TWeakObjectPtr< ULandscapeLayerInfoObject > LayerInfo;
+
+        /** Mapping used when converting the values of this volume. **/
+        FHoudiniLandscapeValueMapping Mapping;
+    };
+
+    FHoudiniLandscapeHeightfieldState();
+
+    /** Returns true if volumes have been created for a landscape. **/
+    bool IsValid() const;
+
+    /** Forget the created volumes and the modified components. **/
+    void Reset();
+
+    /** Landscape that was sent. **/
+    TWeakObjectPtr< ALandscape > Landscape;
+
+    /** Landscape transform at the time of the upload. **/
+    FTransform Transform;
+
+    /** Landscape extent at the time of the upload. **/
+    int32 MinX;
+    int32 MinY;
+    int32 MaxX;
+    int32 MaxY;
+
+    /** Number of layers of the landscape at the time of the upload. **/
+    int32 NumLayers;
+
+    /** Size of the volume tiles, as reported by Houdini for the height volume. **/
+    int32 TileSize;
+
+    /** Height volume first, followed by the paint layer volumes. **/
+    TArray< FVolume > Volumes;
+
+    /** Components modified since the last upload. **/
+    TSet< TWeakObjectPtr< ULandscapeComponent > > DirtyComponents;
+};
 
 struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
 {
@@ -71,6 +147,16 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
 			int32 XSize, int32 YSize,
 			int32 NumSectionPerLandscapeComponent, int32 NumQuadsPerLandscapeSection);
 
+        // Updates an existing landscape by only writing the components whose height or layer values have changed
+        // Returns false if the landscape's layout differs or if too many components changed, it then needs a full update
+        static bool UpdateLandscapeRegions(
+            ALandscape* ExistingLandscape,
+            const TArray< uint16 >& IntHeightData,
+            const TArray< FLandscapeImportLayerInfo >& ImportLayerInfos,
+            const FTransform& LandscapeTransform,
+            const int32& XSize, const int32& YSize,
+            const int32& NumSectionPerLandscapeComponent, const int32& NumQuadsPerLandscapeSection );
+
         // Returns the materials assigned to the heightfield
         static void GetHeightFieldLandscapeMaterials(
             const FHoudiniGeoPartObject& Heightfield,
@@ -156,8 +242,17 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
 
 #if WITH_EDITOR
         // Creates a heightfield from a Landscape
+        // The created volumes are recorded in OutState if provided, to allow incremental updates later on
         static bool CreateHeightfieldFromLandscape(
-            ALandscapeProxy* LandscapeProxy, const HAPI_NodeId& InputMergeNodeId );
+            ALandscapeProxy* LandscapeProxy, const HAPI_NodeId& InputMergeNodeId,
+            FHoudiniLandscapeHeightfieldState* OutState = nullptr );
+
+        // Sends the components modified since the last upload as tiles to the volumes created by CreateHeightfieldFromLandscape
+        // Returns false if the landscape, its layers or the value ranges changed and the heightfield has to be recreated
+        static bool UpdateHeightfieldFromLandscape( FHoudiniLandscapeHeightfieldState& State );
+
+        // Adds the landscape components using Object (component or heightmap/weightmap texture) to the state's modified components
+        static void MarkHeightfieldComponentsDirty( FHoudiniLandscapeHeightfieldState& State, UObject* Object );
 
         // Creates multiple heightfield from an array of Landscape Components
         static bool CreateHeightfieldFromLandscapeComponentArray(
@@ -208,7 +303,8 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             FVector Min, FVector Max,
             const FTransform& LandscapeTransform,
             TArray<float>& HeightfieldFloatValues,
-            HAPI_VolumeInfo& HeightfieldVolumeInfo );
+            HAPI_VolumeInfo& HeightfieldVolumeInfo,
+            FHoudiniLandscapeValueMapping* OutMapping = nullptr );
 
         // Converts Unreal uint8 values to Houdini Float
         static bool ConvertLandscapeLayerDataToHeightfieldData(
@@ -216,7 +312,8 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             const int32& XSize, const int32& YSize,
             const FLinearColor& LayerUsageDebugColor,
             TArray<float>& LayerFloatValues,
-            HAPI_VolumeInfo& LayerVolumeInfo);
+            HAPI_VolumeInfo& LayerVolumeInfo,
+            FHoudiniLandscapeValueMapping* OutMapping = nullptr );
 
         // Set the volume float value for a heightfield
         static bool SetHeighfieldData(
@@ -226,6 +323,19 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             const FString& HeightfieldName,
             const int32& TileIndex );
 
+        // Returns the display node of a committed volume input node and the tile size of its volume
+        static bool GetVolumeDisplayInfo(
+            const HAPI_NodeId& VolumeNodeId, const HAPI_PartId& PartId,
+            HAPI_NodeId& DisplayNodeId, int32& TileSize );
+
+        // Sends the values of the given volume region as TileSize x TileSize tiles to the volume of a display node
+        // Values are in Houdini order, RegionMinX/Y and RegionXSize/YSize are expressed in volume voxels
+        static bool SetHeightfieldTileData(
+            const HAPI_NodeId& DisplayNodeId, const HAPI_PartId& PartId, const int32& TileSize,
+            const TArray< float >& FloatValues,
+            const int32& RegionMinX, const int32& RegionMinY,
+            const int32& RegionXSize, const int32& RegionYSize );
+
         // Creates an input node for Heightfields (this will be a SOP/merge node)
         static bool CreateHeightfieldInputNode(
             HAPI_NodeId& DisplayNodeId,
@@ -23,6 +23,7 @@
 
 #include "HoudiniApi.h"
 #include "Components/StaticMeshComponent.h"
+#include "StaticMeshResources.h"
 #include "HoudiniMeshSplitInstancerComponent.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #if WITH_EDITOR
@@ -68,6 +69,101 @@ UHoudiniMeshSplitInstancerComponent::AddReferencedObjects( UObject * InThis, FRe
     }
 }
 
+#if WITH_EDITOR
+
+/** Fill the override vertex colors of all LODs of a component with a single color, return true if they changed. **/
+/** The component must not be registered, replaced buffers are released and added to BuffersToDelete. **/
+static bool
+HoudiniFillOverrideVertexColors(
+    UStaticMeshComponent * SMC, const FColor & Color, TArray< FColorVertexBuffer * > & BuffersToDelete )
+{
+    UStaticMesh * StaticMesh = SMC->StaticMesh;
+    if ( !StaticMesh || !StaticMesh->RenderData )
+        return false;
+
+    const int32 NumLODs = StaticMesh->RenderData->LODResources.Num();
+    SMC->SetLODDataCount( NumLODs, NumLODs );
+
+    bool bChanged = false;
+    for ( int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex )
+    {
+        FStaticMeshComponentLODInfo & LODInfo = SMC->LODData[ LODIndex ];
+        const uint32 NumVertices = StaticMesh->RenderData->LODResources[ LODIndex ].GetNumVertices();
+
+        // Skip buffers which already hold this color.
+        FColorVertexBuffer * OverrideVertexColors = LODInfo.OverrideVertexColors;
+        if ( OverrideVertexColors && OverrideVertexColors->GetNumVertices() == NumVertices
+            && ( NumVertices == 0 || OverrideVertexColors->VertexColor( 0 ) == Color ) )
+            continue;
+
+        if ( OverrideVertexColors )
+        {
+            BeginReleaseResource( OverrideVertexColors );
+            BuffersToDelete.Add( OverrideVertexColors );
+        }
+
+        LODInfo.OverrideVertexColors = new FColorVertexBuffer;
+        LODInfo.OverrideVertexColors->InitFromSingleColor( Color, NumVertices );
+        BeginInitResource( LODInfo.OverrideVertexColors );
+        bChanged = true;
+    }
+
+    return bChanged;
+}
+
+/** Remove the override vertex colors of a component, return true if it had any. **/
+/** The component must not be registered, removed buffers are released and added to BuffersToDelete. **/
+static bool
+HoudiniRemoveOverrideVertexColors( UStaticMeshComponent * SMC, TArray< FColorVertexBuffer * > & BuffersToDelete )
+{
+    bool bChanged = false;
+    for ( FStaticMeshComponentLODInfo & LODInfo : SMC->LODData )
+    {
+        if ( !LODInfo.OverrideVertexColors )
+            continue;
+
+        BeginReleaseResource( LODInfo.OverrideVertexColors );
+        BuffersToDelete.Add( LODInfo.OverrideVertexColors );
+        LODInfo.OverrideVertexColors = nullptr;
+        bChanged = true;
+    }
+
+    return bChanged;
+}
+
+/** Return true if the override vertex colors of a component need to be updated for the given instance. **/
+static bool
+HoudiniNeedsOverrideVertexColorsUpdate( UStaticMeshComponent * SMC, const TArray< FColor > & InstanceColors, int32 InstanceIdx )
+{
+    const bool bHasColor = InstanceColors.IsValidIndex( InstanceIdx );
+    bool bHasOverrideVertexColors = false;
+    for ( const FStaticMeshComponentLODInfo & LODInfo : SMC->LODData )
+    {
+        FColorVertexBuffer * OverrideVertexColors = LODInfo.OverrideVertexColors;
+        if ( !OverrideVertexColors )
+            continue;
+
+        if ( !bHasColor )
+            return true;
+
+        // Buffers created for a previous build of the mesh no longer match its vertex count.
+        const int32 LODIndex = &LODInfo - SMC->LODData.GetData();
+        UStaticMesh * StaticMesh = SMC->StaticMesh;
+        if ( StaticMesh && StaticMesh->RenderData && StaticMesh->RenderData->LODResources.IsValidIndex( LODIndex )
+            && OverrideVertexColors->GetNumVertices() != StaticMesh->RenderData->LODResources[ LODIndex ].GetNumVertices() )
+            return true;
+
+        if ( OverrideVertexColors->GetNumVertices() > 0 && OverrideVertexColors->VertexColor( 0 ) != InstanceColors[ InstanceIdx ] )
+            return true;
+
+        bHasOverrideVertexColors = true;
+    }
+
+    return bHasColor && !bHasOverrideVertexColors;
+}
+
+#endif
+
 void 
 UHoudiniMeshSplitInstancerComponent::SetInstances( const TArray<FTransform>& InstanceTransforms,
     const TArray<FLinearColor> & InstancedColors)
@@ -76,57 +172,143 @@ UHoudiniMeshSplitInstancerComponent::SetInstances( const TArray<FTransform>& Ins
     if ( Instances.Num() || InstanceTransforms.Num() )
     {
         const FScopedTransaction Transaction( LOCTEXT( "UpdateInstances", "Update Instances" ) );
-        GetOwner()->Modify();
-        ClearInstances();
 
-        if( InstancedMesh )
+        if( !InstancedMesh )
+        {
+            GetOwner()->Modify();
+            ClearInstances();
+
+            HOUDINI_LOG_ERROR( TEXT( "%s: Null InstancedMesh for split instanced mesh override" ), *GetOwner()->GetName() );
+            return;
+        }
+
+        TArray<FColor> InstanceColorOverride;
+        InstanceColorOverride.SetNumUninitialized(InstancedColors.Num());
+        for (int32 ix = 0; ix < InstancedColors.Num(); ++ix)
+        {
+            InstanceColorOverride[ix] = InstancedColors[ix].GetClamped().ToFColor(false);
+        }
+
+        // Forget about components which were destroyed.
+        if ( Instances.ContainsByPredicate( []( UStaticMeshComponent * SMC ) { return !SMC || SMC->IsPendingKill(); } ) )
+        {
+            Modify();
+            Instances.RemoveAll( []( UStaticMeshComponent * SMC ) { return !SMC || SMC->IsPendingKill(); } );
+        }
+
+        // Destroy the components we no longer need.
+        if ( Instances.Num() > InstanceTransforms.Num() )
+        {
+            Modify();
+            for ( int32 InstanceIdx = InstanceTransforms.Num(); InstanceIdx < Instances.Num(); ++InstanceIdx )
+                Instances[ InstanceIdx ]->ConditionalBeginDestroy();
+
+            Instances.SetNum( InstanceTransforms.Num() );
+        }
+
+        // Components are configured while unregistered and registered together at the end, so that
+        // their render state is only created once.
+        TArray< UStaticMeshComponent * > ComponentsToRegister;
+        TArray< FColorVertexBuffer * > BuffersToDelete;
+
+        // Update the components we keep.
+        const int32 MeshMaterialCount = InstancedMesh->Materials.Num();
+        for ( int32 InstanceIdx = 0; InstanceIdx < Instances.Num(); ++InstanceIdx )
+        {
+            UStaticMeshComponent * SMC = Instances[ InstanceIdx ];
+
+            bool bMaterialsChanged = false;
+            if ( OverrideMaterial )
+            {
+                for ( int32 Idx = 0; Idx < MeshMaterialCount && !bMaterialsChanged; ++Idx )
+                    bMaterialsChanged = SMC->GetMaterial( Idx ) != OverrideMaterial;
+            }
+            else
+            {
+                bMaterialsChanged = SMC->OverrideMaterials.Num() > 0;
+            }
+
+            const bool bTransformChanged = !SMC->GetRelativeTransform().Equals( InstanceTransforms[ InstanceIdx ] );
+            const bool bMeshChanged = SMC->StaticMesh != InstancedMesh;
+            const bool bColorsChanged =
+                bMeshChanged || HoudiniNeedsOverrideVertexColorsUpdate( SMC, InstanceColorOverride, InstanceIdx );
+
+            if ( !bTransformChanged && !bMeshChanged && !bMaterialsChanged && !bColorsChanged )
+                continue;
+
+            SMC->Modify();
+
+            // Vertex color buffers can only be replaced once the render state is gone.
+            if ( bMeshChanged || bMaterialsChanged || bColorsChanged )
+            {
+                if ( SMC->IsRegistered() )
+                    SMC->UnregisterComponent();
+
+                ComponentsToRegister.Add( SMC );
+            }
+
+            SMC->SetRelativeTransform( InstanceTransforms[ InstanceIdx ] );
+            SMC->SetStaticMesh( InstancedMesh );
+
+            if ( bMaterialsChanged )
+            {
+                SMC->OverrideMaterials.Empty();
+                if ( OverrideMaterial )
+                {
+                    for ( int32 Idx = 0; Idx < MeshMaterialCount; ++Idx )
+                        SMC->SetMaterial( Idx, OverrideMaterial );
+                }
+            }
+
+            if ( bColorsChanged )
+            {
+                if ( InstanceColorOverride.IsValidIndex( InstanceIdx ) )
+                    HoudiniFillOverrideVertexColors( SMC, InstanceColorOverride[ InstanceIdx ], BuffersToDelete );
+                else
+                    HoudiniRemoveOverrideVertexColors( SMC, BuffersToDelete );
+            }
+        }
+
+        // Create the missing components.
+        if ( Instances.Num() < InstanceTransforms.Num() )
+            Modify();
+
+        for ( int32 InstanceIdx = Instances.Num(); InstanceIdx < InstanceTransforms.Num(); ++InstanceIdx )
         {
-			TArray<FColor> InstanceColorOverride;
-			InstanceColorOverride.SetNumUninitialized(InstancedColors.Num());
-			for (int32 ix = 0; ix < InstancedColors.Num(); ++ix)
-			{
-				InstanceColorOverride[ix] = InstancedColors[ix].GetClamped().ToFColor(false);
-			}
-
-            for( const FTransform& InstanceTransform : InstanceTransforms )
+            UStaticMeshComponent* SMC = ConstructObject< UStaticMeshComponent >(
+                UStaticMeshComponent::StaticClass(), GetOwner(),
+                NAME_None, RF_Transactional);
+
+            SMC->SetRelativeTransform(InstanceTransforms[ InstanceIdx ]);
+            // Attach created static mesh component to this thing
+            SMC->AttachTo(this, NAME_None, EAttachLocation::KeepRelativeOffset);
+
+            SMC->SetStaticMesh(InstancedMesh);
+            SMC->SetVisibility(IsVisible());
+            SMC->SetMobility(Mobility);
+            if( OverrideMaterial )
             {
-				UStaticMeshComponent* SMC = ConstructObject< UStaticMeshComponent >(
-					UStaticMeshComponent::StaticClass(), GetOwner(),
-					NAME_None, RF_Transactional);
-
-				SMC->SetRelativeTransform(InstanceTransform);
-				// Attach created static mesh component to this thing
-				SMC->AttachTo(this, NAME_None, EAttachLocation::KeepRelativeOffset);
-
-				SMC->SetStaticMesh(InstancedMesh);
-				SMC->SetVisibility(IsVisible());
-				SMC->SetMobility(Mobility);
-				if( OverrideMaterial )
-				{
-					int32 MeshMaterialCount = InstancedMesh->Materials.Num();
-					for( int32 Idx = 0; Idx < MeshMaterialCount; ++Idx )
-					SMC->SetMaterial(Idx, OverrideMaterial);
-				}
-
-				// If we have override colors, apply them
-				int32 InstIndex = Instances.Num();
-				if( InstanceColorOverride.IsValidIndex(InstIndex) )
-				{
-					//JC: fixme
-					HOUDINI_LOG_ERROR( TEXT("%s: Failed to fill vertex colors; ask Judd to fix this if required") );
-					//MeshPaintHelpers::FillVertexColors(SMC, InstanceColorOverride[InstIndex], true);
-					//FIXME: How to get rid of the warning about fixup vertex colors on load?
-					//SMC->FixupOverrideColorsIfNecessary();
-				}
-
-				SMC->RegisterComponent();
-
-				Instances.Add(SMC);
+                for( int32 Idx = 0; Idx < MeshMaterialCount; ++Idx )
+                    SMC->SetMaterial(Idx, OverrideMaterial);
             }
+
+            // If we have override colors, apply them
+            if( InstanceColorOverride.IsValidIndex( InstanceIdx ) )
+                HoudiniFillOverrideVertexColors( SMC, InstanceColorOverride[ InstanceIdx ], BuffersToDelete );
+
+            ComponentsToRegister.Add( SMC );
+            Instances.Add(SMC);
         }
-        else
+
+        for ( UStaticMeshComponent * SMC : ComponentsToRegister )
+            SMC->RegisterComponent();
+
+        // Replaced vertex color buffers can be deleted once the rendering thread has released them.
+        if ( BuffersToDelete.Num() > 0 )
         {
-            HOUDINI_LOG_ERROR( TEXT( "%s: Null InstancedMesh for split instanced mesh override" ), *GetOwner()->GetName() );
+            FlushRenderingCommands();
+            for ( FColorVertexBuffer * Buffer : BuffersToDelete )
+                delete Buffer;
         }
     }
 #endif
@@ -48,6 +48,160 @@
 #include "HoudiniParamUtils.h"
 #include "HoudiniRuntimeSettings.h"
 
+const FHoudiniParamUtils::FNodeParmValues *
+FHoudiniParamUtils::BuildParmValues = nullptr;
+
+/** Copy a slice of bulk fetched values, fails if the slice is out of range. */
+template< typename TValue >
+static bool
+CopyParmValuesSlice( const TArray< TValue > & Source, TValue * Values, int32 Start, int32 Count )
+{
+    if( Start < 0 || Count < 0 || Start + Count > Source.Num() )
+        return false;
+
+    if( Count > 0 )
+        FMemory::Memcpy( Values, Source.GetData() + Start, Count * sizeof( TValue ) );
+
+    return true;
+}
+
+bool
+FHoudiniParamUtils::GetParmIntValues( HAPI_NodeId NodeId, int32 * Values, int32 Start, int32 Count )
+{
+    if( BuildParmValues && BuildParmValues->NodeId == NodeId && IsInGameThread()
+        && CopyParmValuesSlice( BuildParmValues->IntValues, Values, Start, Count ) )
+    {
+        return true;
+    }
+
+    return FHoudiniApi::GetParmIntValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, Values, Start, Count ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniParamUtils::GetParmFloatValues( HAPI_NodeId NodeId, float * Values, int32 Start, int32 Count )
+{
+    if( BuildParmValues && BuildParmValues->NodeId == NodeId && IsInGameThread()
+        && CopyParmValuesSlice( BuildParmValues->FloatValues, Values, Start, Count ) )
+    {
+        return true;
+    }
+
+    return FHoudiniApi::GetParmFloatValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, Values, Start, Count ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniParamUtils::GetParmStringValues( HAPI_NodeId NodeId, HAPI_StringHandle * Values, int32 Start, int32 Count )
+{
+    if( BuildParmValues && BuildParmValues->NodeId == NodeId && IsInGameThread()
+        && CopyParmValuesSlice( BuildParmValues->StringValues, Values, Start, Count ) )
+    {
+        return true;
+    }
+
+    return FHoudiniApi::GetParmStringValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, false, Values, Start, Count ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniParamUtils::UploadParameterValues( const TArray< class UHoudiniAssetParameter * > & ChangedParameters )
+{
+    struct FBatchedParameter
+    {
+        UHoudiniAssetParameter * Parameter;
+        const int32 * IntValues;
+        const float * FloatValues;
+    };
+
+    bool bSuccess = true;
+
+    TArray< FBatchedParameter > BatchedParameters;
+    BatchedParameters.Reserve( ChangedParameters.Num() );
+    for( UHoudiniAssetParameter * HoudiniAssetParameter : ChangedParameters )
+    {
+        FBatchedParameter BatchedParameter;
+        BatchedParameter.Parameter = HoudiniAssetParameter;
+        BatchedParameter.IntValues = HoudiniAssetParameter->GetBatchedIntValues();
+        BatchedParameter.FloatValues = BatchedParameter.IntValues ? nullptr : HoudiniAssetParameter->GetBatchedFloatValues();
+
+        if( ( BatchedParameter.IntValues || BatchedParameter.FloatValues ) && HoudiniAssetParameter->GetTupleSize() > 0 )
+            BatchedParameters.Add( BatchedParameter );
+        else
+            bSuccess &= HoudiniAssetParameter->UploadParameterValue();
+    }
+
+    // Order by node, value type and values index so that adjacent value ranges follow each other.
+    BatchedParameters.Sort( []( const FBatchedParameter & A, const FBatchedParameter & B )
+    {
+        if( A.Parameter->GetNodeId() != B.Parameter->GetNodeId() )
+            return A.Parameter->GetNodeId() < B.Parameter->GetNodeId();
+
+        if( ( A.IntValues != nullptr ) != ( B.IntValues != nullptr ) )
+            return A.IntValues != nullptr;
+
+        return A.Parameter->GetValuesIndex() < B.Parameter->GetValuesIndex();
+    } );
+
+    TArray< int32 > IntValues;
+    TArray< float > FloatValues;
+    int32 RunStart = 0;
+    while( RunStart < BatchedParameters.Num() )
+    {
+        const FBatchedParameter & FirstParameter = BatchedParameters[ RunStart ];
+        const HAPI_NodeId NodeId = FirstParameter.Parameter->GetNodeId();
+        const int32 ValuesIndex = FirstParameter.Parameter->GetValuesIndex();
+        const bool bIntValues = FirstParameter.IntValues != nullptr;
+
+        // Gather the values of all parameters of this run.
+        IntValues.Reset();
+        FloatValues.Reset();
+        int32 RunEnd = RunStart;
+        for( ; RunEnd < BatchedParameters.Num(); ++RunEnd )
+        {
+            const FBatchedParameter & BatchedParameter = BatchedParameters[ RunEnd ];
+            const int32 ValueCount = bIntValues ? IntValues.Num() : FloatValues.Num();
+            if( BatchedParameter.Parameter->GetNodeId() != NodeId
+                || ( BatchedParameter.IntValues != nullptr ) != bIntValues
+                || BatchedParameter.Parameter->GetValuesIndex() != ValuesIndex + ValueCount )
+            {
+                break;
+            }
+
+            if( bIntValues )
+                IntValues.Append( BatchedParameter.IntValues, BatchedParameter.Parameter->GetTupleSize() );
+            else
+                FloatValues.Append( BatchedParameter.FloatValues, BatchedParameter.Parameter->GetTupleSize() );
+        }
+
+        HAPI_Result Result = HAPI_RESULT_SUCCESS;
+        if( bIntValues )
+        {
+            Result = FHoudiniApi::SetParmIntValues(
+                FHoudiniEngine::Get().GetSession(), NodeId, IntValues.GetData(), ValuesIndex, IntValues.Num() );
+        }
+        else
+        {
+            Result = FHoudiniApi::SetParmFloatValues(
+                FHoudiniEngine::Get().GetSession(), NodeId, FloatValues.GetData(), ValuesIndex, FloatValues.Num() );
+        }
+
+        if( Result == HAPI_RESULT_SUCCESS )
+        {
+            // Mark these parameters as no longer changed.
+            for( int32 Idx = RunStart; Idx < RunEnd; ++Idx )
+                BatchedParameters[ Idx ].Parameter->UnmarkChanged();
+        }
+        else
+        {
+            bSuccess = false;
+        }
+
+        RunStart = RunEnd;
+    }
+
+    return bSuccess;
+}
 
 bool 
 FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
@@ -85,6 +239,46 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
                 FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, &ParmInfos[ 0 ], 0,
                 NodeInfo.parmCount ), false );
 
+        // Retrieve all parameter values with one call per type, parameters copy their slice
+        // using the values index of their parm info.
+        FNodeParmValues ParmValues;
+        ParmValues.NodeId = AssetInfo.nodeId;
+        if( NodeInfo.parmIntValueCount > 0 )
+        {
+            ParmValues.IntValues.SetNumUninitialized( NodeInfo.parmIntValueCount );
+            HOUDINI_CHECK_ERROR_RETURN(
+                FHoudiniApi::GetParmIntValues(
+                    FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, ParmValues.IntValues.GetData(), 0,
+                    NodeInfo.parmIntValueCount ), false );
+        }
+
+        if( NodeInfo.parmFloatValueCount > 0 )
+        {
+            ParmValues.FloatValues.SetNumUninitialized( NodeInfo.parmFloatValueCount );
+            HOUDINI_CHECK_ERROR_RETURN(
+                FHoudiniApi::GetParmFloatValues(
+                    FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, ParmValues.FloatValues.GetData(), 0,
+                    NodeInfo.parmFloatValueCount ), false );
+        }
+
+        if( NodeInfo.parmStringValueCount > 0 )
+        {
+            ParmValues.StringValues.SetNumUninitialized( NodeInfo.parmStringValueCount );
+            HOUDINI_CHECK_ERROR_RETURN(
+                FHoudiniApi::GetParmStringValues(
+                    FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, false, ParmValues.StringValues.GetData(), 0,
+                    NodeInfo.parmStringValueCount ), false );
+        }
+
+        check( IsInGameThread() );
+        TGuardValue< const FNodeParmValues * > BuildParmValuesGuard( BuildParmValues, &ParmValues );
+
+        // Create parm id lookup, used to walk up the parent folders.
+        TMap< HAPI_ParmId, int32 > ParmIndicesById;
+        ParmIndicesById.Reserve( NodeInfo.parmCount );
+        for( int32 ParamIdx = 0; ParamIdx < NodeInfo.parmCount; ++ParamIdx )
+            ParmIndicesById.Add( ParmInfos[ ParamIdx ].id, ParamIdx );
+
         // Create name lookup cache
         TMap<FString, UHoudiniAssetParameter*> CurrentParametersByName;
         CurrentParametersByName.Reserve( CurrentParameters.Num() );
@@ -115,10 +309,9 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
             HAPI_ParmId ParentId = ParmInfo.parentId;
             while( ParentId > 0 && !SkipParm )
             {
-                if( const HAPI_ParmInfo* ParentInfoPtr = ParmInfos.FindByPredicate( [=]( const HAPI_ParmInfo& Info ) {
-                    return Info.id == ParentId;
-                } ) )
+                if( const int32* ParentIdxPtr = ParmIndicesById.Find( ParentId ) )
                 {
+                    const HAPI_ParmInfo* ParentInfoPtr = &ParmInfos[ *ParentIdxPtr ];
                     if( ParentInfoPtr->invisible && ParentInfoPtr->type == HAPI_PARMTYPE_FOLDER )
                         SkipParm = true;
                     ParentId = ParentInfoPtr->parentId;
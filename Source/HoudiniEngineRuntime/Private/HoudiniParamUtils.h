@@ -40,4 +40,30 @@ struct HOUDINIENGINERUNTIME_API FHoudiniParamUtils
     static bool Build( HAPI_NodeId AssetId, class UObject* PrimaryObject, 
         TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& CurrentParameters,
         TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& NewParameters );
+
+    /** Retrieve a slice of the parameter values of a node. While Build is running for that node the
+        slice is copied from the values it fetched in bulk, otherwise the values are requested from HAPI.
+    */
+    static bool GetParmIntValues( HAPI_NodeId NodeId, int32 * Values, int32 Start, int32 Count );
+    static bool GetParmFloatValues( HAPI_NodeId NodeId, float * Values, int32 Start, int32 Count );
+    static bool GetParmStringValues( HAPI_NodeId NodeId, HAPI_StringHandle * Values, int32 Start, int32 Count );
+
+    /** Upload the values of changed parameters. Int and float parameters of the same node whose value ranges
+        are adjacent are merged into a single set call, other parameters upload their values on their own.
+    */
+    static bool UploadParameterValues( const TArray< class UHoudiniAssetParameter * > & ChangedParameters );
+
+protected:
+
+    /** All int, float and (unevaluated) string values of a node, fetched with one call per type. */
+    struct FNodeParmValues
+    {
+        HAPI_NodeId NodeId = -1;
+        TArray< int32 > IntValues;
+        TArray< float > FloatValues;
+        TArray< HAPI_StringHandle > StringValues;
+    };
+
+    /** Values of the node currently being built, only set on the game thread for the duration of Build. */
+    static const FNodeParmValues * BuildParmValues;
 };
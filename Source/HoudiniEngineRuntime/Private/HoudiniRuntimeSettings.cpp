@@ -39,6 +39,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const class FPostConstructInit
     ServerPipeName = HAPI_UNREAL_SESSION_SERVER_PIPENAME;
     bStartAutomaticServer = HAPI_UNREAL_SESSION_SERVER_AUTOSTART;
     AutomaticServerTimeout = HAPI_UNREAL_SESSION_SERVER_TIMEOUT;
+    bStartSessionInBackground = true;
 
 #if PLATFORM_LINUX
     // Since 4.17, Linux has library conflict, so we need to create an out-of-process session by default
@@ -59,9 +60,15 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const class FPostConstructInit
     bCookCurvesOnMouseRelease = false;
 
     TemporaryCookFolder = LOCTEXT("Temp", "/Game/HoudiniEngine/Temp");
+    bAdaptiveCookStatePolling = true;
+    CookStatePollingMinInterval = 1.0f;
+    CookStatePollingMaxInterval = 50.0f;
+    CookProgressNotificationInterval = 0.5f;
+    bReuseInstancedActors = true;
 
     /** Parameter options. **/
     bTreatRampParametersAsMultiparms = false;
+    ParameterUploadDelay = 0.1f;
 
     /** Collision generation. **/
     CollisionGroupNamePrefix = TEXT( HAPI_UNREAL_GROUP_GEOMETRY_COLLISION );
@@ -86,6 +93,8 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const class FPostConstructInit
     MarshallingLandscapesForceMinMaxValues = false;
     MarshallingLandscapesForcedMinValue = -2000.0f;
     MarshallingLandscapesForcedMaxValue = 4553.0f;
+    bShareInputMeshNodes = true;
+    bMarshallingSplinesAsCurveAttributes = true;
 
     /** Geometry scaling. **/
     GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
@@ -115,6 +124,8 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const class FPostConstructInit
     RecomputeTangentsFlag = HRSRF_OnlyIfMissing;
     bUseMikkTSpace = true;
     bBuildAdjacencyBuffer = false;
+    bDeferStaticMeshBuild = true;
+    DeferredStaticMeshBuildTimeBudget = 50.0f;
 
     /** Custom Houdini location. **/
     bUseCustomHoudiniLocation = false;
@@ -222,6 +233,10 @@ UHoudiniRuntimeSettings::PostInitProperties()
             Property->SetPropertyFlags( CPF_EditConst );
     }
 
+    // Set cook state polling intervals as read only when polling is not adaptive.
+    SetPropertyReadOnly( TEXT( "CookStatePollingMinInterval" ), !bAdaptiveCookStatePolling );
+    SetPropertyReadOnly( TEXT( "CookStatePollingMaxInterval" ), !bAdaptiveCookStatePolling );
+
     // Disable UI elements depending on current session type.
 #if WITH_EDITOR
 
@@ -274,6 +289,27 @@ UHoudiniRuntimeSettings::PostEditChangeProperty( struct FPropertyChangedEvent &
     }
     else if (Property->GetName() == TEXT("MarshallingSplineResolution"))
         MarshallingSplineResolution = FMath::Clamp(MarshallingSplineResolution, 0.0f, 10000.0f);
+    else if ( Property->GetName() == TEXT( "bAdaptiveCookStatePolling" ) )
+    {
+        SetPropertyReadOnly( TEXT( "CookStatePollingMinInterval" ), !bAdaptiveCookStatePolling );
+        SetPropertyReadOnly( TEXT( "CookStatePollingMaxInterval" ), !bAdaptiveCookStatePolling );
+    }
+    else if ( Property->GetName() == TEXT( "CookStatePollingMinInterval" ) )
+    {
+        CookStatePollingMinInterval = FMath::Clamp( CookStatePollingMinInterval, 0.0f, 1000.0f );
+        CookStatePollingMaxInterval = FMath::Max( CookStatePollingMaxInterval, CookStatePollingMinInterval );
+    }
+    else if ( Property->GetName() == TEXT( "CookStatePollingMaxInterval" ) )
+    {
+        CookStatePollingMaxInterval = FMath::Clamp( CookStatePollingMaxInterval, 0.0f, 1000.0f );
+        CookStatePollingMinInterval = FMath::Min( CookStatePollingMinInterval, CookStatePollingMaxInterval );
+    }
+    else if ( Property->GetName() == TEXT( "CookProgressNotificationInterval" ) )
+        CookProgressNotificationInterval = FMath::Clamp( CookProgressNotificationInterval, 0.05f, 60.0f );
+    else if ( Property->GetName() == TEXT( "ParameterUploadDelay" ) )
+        ParameterUploadDelay = FMath::Clamp( ParameterUploadDelay, 0.0f, 10.0f );
+    else if ( Property->GetName() == TEXT( "DeferredStaticMeshBuildTimeBudget" ) )
+        DeferredStaticMeshBuildTimeBudget = FMath::Clamp( DeferredStaticMeshBuildTimeBudget, 1.0f, 1000.0f );
 
     if ( Property->GetName() == TEXT( "MarshallingLandscapesForceMinMaxValues" ) )
     {
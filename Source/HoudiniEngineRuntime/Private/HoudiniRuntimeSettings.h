@@ -214,6 +214,10 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY( GlobalConfig, EditAnywhere, Category = Session )
         float AutomaticServerTimeout;
 
+        /** Whether to create the session on a background thread, so that it does not delay editor startup */
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Session )
+        bool bStartSessionInBackground;
+
     /** Instantiation options. **/
     public:
 
@@ -252,6 +256,28 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
         FText TemporaryCookFolder;
 
+        // If enabled, the delay between two cook state polls grows exponentially while an asset is cooking,
+        // instead of polling continuously. Each poll is a round trip to the session.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bAdaptiveCookStatePolling;
+
+        // Initial delay between two cook state polls, in milliseconds.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, Meta = ( UIMin = "0.0", UIMax = "10.0" ) )
+        float CookStatePollingMinInterval;
+
+        // Maximum delay between two cook state polls, in milliseconds.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, Meta = ( UIMin = "1.0", UIMax = "250.0" ) )
+        float CookStatePollingMaxInterval;
+
+        // Delay between two fetches of the cook progress string used for notifications, in seconds.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking, Meta = ( UIMin = "0.1", UIMax = "5.0" ) )
+        float CookProgressNotificationInterval;
+
+        // If enabled, actors spawned by actor instancers are reused across cooks: existing actors are moved
+        // and only the difference in instance count is spawned or destroyed.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Cooking )
+        bool bReuseInstancedActors;
+
     /** Parameter options. **/
     public:
 
@@ -259,6 +285,11 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY( GlobalConfig, EditAnywhere, Category = Parameters )
         bool bTreatRampParametersAsMultiparms;
 
+        // Parameter edits are only uploaded once no edit happened for this delay, in seconds. Rapid edits,
+        // like slider drags, then only upload their latest values before the next cook.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Parameters, Meta = ( UIMin = "0.0", UIMax = "2.0" ) )
+        float ParameterUploadDelay;
+
     /** Collision generation. **/
     public:
 
@@ -349,6 +380,16 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
         float MarshallingLandscapesForcedMaxValue;
 
+        // If true, static meshes used by several inputs are only uploaded once per session,
+        // inputs reference the shared geometry through object merge nodes.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = GeometryMarshalling )
+        bool bShareInputMeshNodes;
+
+        // If true, Unreal splines are sent to Houdini as curve geometry with their points, rotations and scales
+        // set directly as attributes, instead of through the coords parameter of a curve SOP.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = GeometryMarshalling )
+        bool bMarshallingSplinesAsCurveAttributes;
+
     /** Geometry scaling. **/
     public:
 
@@ -486,6 +527,15 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY( GlobalConfig, EditAnywhere, Category = StaticMeshBuildSettings )
         bool bBuildAdjacencyBuffer;
 
+        // If enabled, static meshes generated by a cook are built over the following editor ticks instead of
+        // during the cook. Meshes keep their previous render data until they are rebuilt.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = StaticMeshBuildSettings )
+        bool bDeferStaticMeshBuild;
+
+        // Time spent building deferred static meshes on each editor tick, in milliseconds.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = StaticMeshBuildSettings, Meta = ( UIMin = "1.0", UIMax = "250.0" ) )
+        float DeferredStaticMeshBuildTimeBudget;
+
     /** Custom Houdini location. **/
     public:
 
@@ -83,6 +83,8 @@ struct HOUDINIENGINERUNTIME_API FHoudiniCookParams
     /** Cache of the temp cook content packages created by the asset for its Landscape layers		    **/
     /** As packages are unique their are used as the key (we can have multiple package for the same geopartobj  **/
     TMap< TWeakObjectPtr<class UPackage>, FHoudiniGeoPartObject >* CookedTemporaryLandscapeLayers = nullptr;
+    // If set, generated static meshes that can be built later are queued here instead of being built during the cook
+    TArray< TWeakObjectPtr<class UStaticMesh> >* DeferredStaticMeshBuilds = nullptr;
 
 	int32 NumLODsToGenerate = 0;
 
@@ -67,3 +67,55 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineString
         /** Id of the underlying Houdini Engine string. **/
         int32 StringId;
 };
+
+/** Cache of resolved Houdini Engine strings. String handles are only stable until the next cook, so strings **/
+/** are only kept while a FHoudiniEngineStringCacheScope is active, outside of one each call resolves its handles **/
+/** directly. Code cooking a node while in scope must call Reset. **/
+class HOUDINIENGINERUNTIME_API FHoudiniEngineStringCache
+{
+    friend class FHoudiniEngineStringCacheScope;
+
+    public:
+
+        /** Resolve an array of string handles. Each unique handle is only fetched once per scope. **/
+        static bool ResolveHandles( const TArray< int32 > & StringIds, TArray< FString > & Strings );
+
+        /** Resolve a single string handle through the cache. **/
+        static bool ToFString( int32 StringId, FString & String );
+        static bool ToFName( int32 StringId, FName & Name );
+
+        /** Discard all cached strings. **/
+        static void Reset();
+
+    protected:
+
+        /** Fetch and store the given handle if it is not cached yet, must be called with the lock held. **/
+        static const FString * FindOrResolve( int32 StringId );
+
+        /** Discard the strings resolved by the current call if no scope is active, must be called with the lock held. **/
+        static void DiscardUnscoped();
+
+    protected:
+
+        /** Synchronization primitive. **/
+        static FCriticalSection CriticalSection;
+
+        /** Resolved strings. **/
+        static TMap< int32, FString > Strings;
+
+        /** Resolved names, created on demand from resolved strings. **/
+        static TMap< int32, FName > Names;
+
+        /** Number of active scopes. **/
+        static int32 ScopeCount;
+};
+
+/** Keep resolved strings cached while in scope, typically for the translation of one cook's results. The cache **/
+/** starts empty and is discarded when the outermost scope exits. **/
+class HOUDINIENGINERUNTIME_API FHoudiniEngineStringCacheScope
+{
+    public:
+
+        FHoudiniEngineStringCacheScope();
+        ~FHoudiniEngineStringCacheScope();
+};
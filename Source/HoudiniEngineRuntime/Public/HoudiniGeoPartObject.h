@@ -563,6 +563,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGeoPartObject
         /** Path to the corresponding node */
         mutable FString NodePath;
 
+        /** Hash of the geometry buffers this part was built from, 0 if unknown. **/
+        uint32 ContentHash;
+
         /** Flags used by geo part object. **/
         union
         {